@@ -21,7 +21,7 @@
     #define STG_COMPILER_MSVC
 #elif defined(__clang__)
     #define STG_COMPILER_CLANG
-#elif defined(__gcc__)
+#elif defined(__GNUC__)
     #define STG_COMPILER_GCC
 #else
     #error "This compiler is not supported"
@@ -72,6 +72,14 @@
         } while(0)
 #endif 
 
+#ifndef STG_THREAD_LOCAL
+    #if defined(STG_COMPILER_MSVC)
+        #define STG_THREAD_LOCAL __declspec(thread)
+    #else
+        #define STG_THREAD_LOCAL __thread
+    #endif
+#endif // STG_THREAD_LOCAL
+
 /************************
  * Common native types 
  ************************/
@@ -92,7 +100,6 @@ typedef unsigned char stg_bool_t;
  ************************/
 void *stg_memcpy(void *dst, const char *src, stg_size_t size);
 void *stg_memset(void *dst, const int value, stg_size_t size);
-// Not implemented
 void *stg_malloc(stg_size_t size);
 void  stg_free(void *ptr);
 
@@ -101,6 +108,12 @@ void  stg_free(void *ptr);
  ************************/
 stg_size_t stg_strlen(const char *cstr);
 char *stg_strncpy(char *dst, const char *src, stg_size_t length);
+// Checks that `data` is well formed UTF-8: no overlong forms, surrogates, code points
+// above U+10FFFF or truncated sequences. On failure the offset of the first bad sequence
+// is stored in `error_offset` unless it is STG_NULL.
+stg_bool_t stg_utf8_validate(const char *data, stg_size_t count, stg_size_t *error_offset);
+// Decodes the code point at the start of `data`, returns its length in bytes or 0 when malformed
+stg_size_t stg_utf8_decode(const char *data, stg_size_t count, unsigned int *codepoint);
 // Not implemented
 void stg_string_format(char *dst, stg_size_t dst_capacity, const char *fmt, ...);
 void stg_string_format_v(char *dst, stg_size_t dst_capacity, const char *fmt, va_list ap);
@@ -134,35 +147,36 @@ stg_bool_t stg_sv_eq(stg_string_view a, stg_string_view b);
 #define stg_da_append(da_ptr, item)                                             \
     do {                                                                        \
         if((da_ptr)->count >= (da_ptr)->capacity) {                             \
-            size_t new_capacity = (da_ptr)->capacity * 2;                       \
-            if(new_capacity == 0) new_capacity = DA_INIT_CAPACITY;              \
-            void *new_data = stg_malloc(new_capacity * sizeof(*(da)->data));    \
+            stg_size_t new_capacity = (da_ptr)->capacity * 2;                   \
+            if(new_capacity == 0) new_capacity = STG_DA_INIT_CAPACITY;          \
+            void *new_data = stg_malloc(new_capacity * sizeof(*(da_ptr)->data));\
             stg_assert(new_data && "Buy more RAM LOL!");                        \
-            stg_memcpy(new_data, (da)->data,                                    \
-                (da)->count * sizeof(*(da)->data));                             \
-            stg_free((da)->data);                                               \
-            (da)->data = new_data;                                              \
-            (da)->capacity = new_capacity;                                      \
+            stg_memcpy(new_data, (const char *)(da_ptr)->data,                  \
+                (da_ptr)->count * sizeof(*(da_ptr)->data));                     \
+            stg_free((da_ptr)->data);                                           \
+            (da_ptr)->data = new_data;                                          \
+            (da_ptr)->capacity = new_capacity;                                  \
         }                                                                       \
-        (da)->data[(da)->count++] = (item);                                     \
+        (da_ptr)->data[(da_ptr)->count++] = (item);                             \
     } while(0)
 
 #define stg_da_append_many(da_ptr, items, items_count)                          \
     do {                                                                        \
-        if((da_ptr)->count + new_items_count > (da_ptr)->capacity) {            \
-            if((da_ptr)->capacity == 0) (da_ptr)->capacity = DA_INIT_CAPACITY;  \
-            new_capacity = (da_ptr)->capacity * 2 + new_items_count;            \
-            void *new_data = stg_malloc(new_capacity * sizeof(*(da_ptr)->data); \
+        if((da_ptr)->count + (items_count) > (da_ptr)->capacity) {              \
+            stg_size_t new_capacity = (da_ptr)->capacity;                       \
+            if(new_capacity == 0) new_capacity = STG_DA_INIT_CAPACITY;          \
+            new_capacity = new_capacity * 2 + (items_count);                    \
+            void *new_data = stg_malloc(new_capacity * sizeof(*(da_ptr)->data));\
             stg_assert(new_data && "Buy more RAM LOL!");                        \
-            stg_memcpy(new_data, (da_ptr)->data,                                \
+            stg_memcpy(new_data, (const char *)(da_ptr)->data,                  \
                 (da_ptr)->count * sizeof(*(da_ptr)->data));                     \
             stg_free((da_ptr)->data);                                           \
             (da_ptr)->data = new_data;                                          \
             (da_ptr)->capacity = new_capacity;                                  \
         }                                                                       \
-        memcpy((da_ptr)->data + (da_ptr)->count, new_items,                     \
-                new_items_count * sizeof(*(da_ptr)->data));                     \
-        (da_ptr)->count += new_items_count;                                     \
+        stg_memcpy((da_ptr)->data + (da_ptr)->count, (const char *)(items),     \
+                (items_count) * sizeof(*(da_ptr)->data));                       \
+        (da_ptr)->count += (items_count);                                       \
     } while(0)
 
 #define stg_da_free(da_ptr) stg_free((da_ptr)->data)
@@ -183,9 +197,109 @@ void stg_tracelog(stg_log_level level, const char *fmt, ...);
 #else
     #define STG_TRACELOG(level, ...) stg_tracelog(level, __VA_ARGS__)
     void __stg_report_assertion_failure(const char *file, int line, const char *reason);
-    #define stg_assert(CONDITION) if(CONDITION) {} else { __stg_report_assertion_failure(__FILE__, __LINE__, #CONDITION) }
+    #define stg_assert(CONDITION) if(CONDITION) {} else { __stg_report_assertion_failure(__FILE__, __LINE__, #CONDITION); }
+#endif
+
+/************************
+ * Atomics
+ ************************/
+// Only implemented with the GCC/Clang builtins for now, STG_HAS_ATOMICS tells whether they exist
+#if defined(STG_COMPILER_CLANG) || defined(STG_COMPILER_GCC)
+    #define STG_HAS_ATOMICS
+    #define stg_atomic_load(ptr)                    __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define stg_atomic_load_relaxed(ptr)            __atomic_load_n((ptr), __ATOMIC_RELAXED)
+    #define stg_atomic_store(ptr, value)            __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define stg_atomic_store_relaxed(ptr, value)    __atomic_store_n((ptr), (value), __ATOMIC_RELAXED)
+    // Returns the new value
+    #define stg_atomic_add(ptr, value)              __atomic_add_fetch((ptr), (value), __ATOMIC_SEQ_CST)
+    // `expected` must be an lvalue, it receives the current value on failure
+    #define stg_atomic_cas(ptr, expected, desired)  \
+        __atomic_compare_exchange_n((ptr), &(expected), (desired), 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+    #define stg_atomic_fence()                      __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif // STG_HAS_ATOMICS
+
+/************************
+ * Job system
+ ************************/
+// Needs the atomics and the platform threads and futexes, which are only implemented on Linux
+#if defined(STG_HAS_ATOMICS) && defined(STG_PLATFORM_LINUX)
+    #define STG_HAS_JOB_SYSTEM
 #endif
 
+#ifdef STG_HAS_JOB_SYSTEM
+// Capacity of each worker queue, must be a power of two. Jobs pushed on a full queue run immediately.
+#ifndef STG_JOB_QUEUE_CAPACITY
+    #define STG_JOB_QUEUE_CAPACITY 4096
+#endif // STG_JOB_QUEUE_CAPACITY
+
+typedef void (*stg_job_proc)(void *user_data);
+typedef void (*stg_job_range_proc)(void *user_data, stg_size_t begin, stg_size_t end);
+
+// Number of unfinished jobs of a fork-join group, zero initialize it before use
+typedef struct stg_job_counter {
+    int value;
+} stg_job_counter;
+
+typedef struct stg_job_system stg_job_system;
+
+// `worker_count` includes the calling thread, 0 means one worker per processor. Jobs can
+// only be started from the thread that created the system or from inside a job. A thread
+// that creates several systems must destroy them in reverse order of creation.
+stg_job_system *stg_job_system_create(stg_size_t worker_count);
+void stg_job_system_destroy(stg_job_system *system);
+stg_size_t stg_job_system_worker_count(stg_job_system *system);
+void stg_job_run(stg_job_system *system, stg_job_proc proc, void *user_data, stg_job_counter *counter);
+// Runs pending jobs until `counter` drops to zero, so jobs can wait on jobs they started
+void stg_job_wait(stg_job_system *system, stg_job_counter *counter);
+// Calls `proc` on chunks of about `grain` indices of [0, count) and waits for all of them
+void stg_job_parallel_for(stg_job_system *system, stg_size_t count, stg_size_t grain, stg_job_range_proc proc, void *user_data);
+#endif // STG_HAS_JOB_SYSTEM
+
+/************************
+ * Profiling
+ ************************/
+// Needs the atomics. Zones are only recorded when STG_PROFILE is defined, the macros expand to
+// nothing otherwise. Every thread records into its own buffer of STG_PROFILE_BUFFER_CAPACITY zones, once
+// it is full further zones are dropped and counted until stg_profile_reset makes room again.
+// Buffers live until the process exits.
+#ifndef STG_PROFILE_BUFFER_CAPACITY
+    #define STG_PROFILE_BUFFER_CAPACITY 65536
+#endif // STG_PROFILE_BUFFER_CAPACITY
+
+typedef struct stg_profile_zone {
+    const char *name;
+    stg_size_t start, end; // stg_profile_ticks()
+} stg_profile_zone;
+
+#if defined(STG_PROFILE) && defined(STG_HAS_ATOMICS)
+    #define STG__PROFILE_CONCAT2(a, b) a##b
+    #define STG__PROFILE_CONCAT(a, b) STG__PROFILE_CONCAT2(a, b)
+    // Times the rest of the enclosing scope, `name` must outlive the export
+    #define STG_PROFILE_ZONE(name)                                                                      \
+        stg_profile_zone STG__PROFILE_CONCAT(stg__profile_zone_, __LINE__)                              \
+            __attribute__((cleanup(stg_profile_zone_end))) = { (name), stg_profile_ticks(), 0 }
+    #define STG_PROFILE_FUNCTION() STG_PROFILE_ZONE(__func__)
+#else
+    #define STG_PROFILE_ZONE(name)
+    #define STG_PROFILE_FUNCTION()
+#endif
+
+#ifdef STG_HAS_ATOMICS
+// rdtsc where available, nanoseconds otherwise. Converted to time on export with a tick rate
+// measured once per process, which takes about a millisecond on the first recorded zone.
+stg_size_t stg_profile_ticks(void);
+void stg_profile_zone_end(stg_profile_zone *zone);
+// Writes the zones recorded so far by every thread as Chrome trace event JSON (chrome://tracing,
+// Perfetto) and returns its length like snprintf: nothing is written past `capacity` and the
+// JSON is null terminated when there is room for it. Threads may keep recording meanwhile.
+stg_size_t stg_profile_export_chrome_trace(char *buffer, stg_size_t capacity);
+// Zones dropped since the last reset
+stg_size_t stg_profile_dropped_zones(void);
+// Forgets the zones recorded so far by every thread, typically right after an export. Threads
+// may keep recording meanwhile, but it must not run concurrently with an export.
+void stg_profile_reset(void);
+#endif // STG_HAS_ATOMICS
+
 /************************
  * Platform dependent API 
  ************************/
@@ -193,6 +307,20 @@ void stg_platform_console_write(const char *message);
 void stg_platform_console_error(const char *message);
 void *stg_platform_heap_alloc(stg_size_t size);
 void stg_platform_heap_free(void *ptr);
+// Monotonic clock in nanoseconds, only meaningful as a difference between two calls
+stg_size_t stg_platform_get_time_ns(void);
+
+typedef struct stg_platform_thread {
+    stg_size_t handle;
+} stg_platform_thread;
+typedef void (*stg_platform_thread_proc)(void *user_data);
+stg_bool_t stg_platform_thread_create(stg_platform_thread *thread, stg_platform_thread_proc proc, void *user_data);
+void stg_platform_thread_join(stg_platform_thread thread);
+void stg_platform_thread_yield(void);
+stg_size_t stg_platform_processor_count(void);
+// Sleeps while `*address == expected`, may return spuriously
+void stg_platform_futex_wait(int *address, int expected);
+void stg_platform_futex_wake(int *address, int count);
 
 #endif // STG_INCLUDED
 
@@ -213,6 +341,18 @@ void *stg_memset(void *dst, const int value, stg_size_t size)
     return dst;
 }
 
+void *stg_malloc(stg_size_t size)
+{
+    STG_PROFILE_FUNCTION();
+    return stg_platform_heap_alloc(size);
+}
+
+void stg_free(void *ptr)
+{
+    STG_PROFILE_FUNCTION();
+    stg_platform_heap_free(ptr);
+}
+
 char *stg_strncpy(char *dst, const char *src, stg_size_t length)
 {
     for(stg_size_t i = 0; i < length; ++i) 
@@ -226,6 +366,223 @@ stg_size_t stg_strlen(const char *cstr) {
     return i;
 }
 
+stg_size_t stg_utf8_decode(const char *data, stg_size_t count, unsigned int *codepoint)
+{
+    const stg_byte_t *s = STG_CAST(const stg_byte_t *, data);
+    if(count == 0) return 0;
+    if(s[0] < 0x80) {
+        if(codepoint) *codepoint = s[0];
+        return 1;
+    }
+
+    // Allowed range of the second byte, narrower after leads that could start overlong
+    // forms, surrogates or code points above U+10FFFF
+    stg_size_t length;
+    stg_byte_t lo = 0x80, hi = 0xBF;
+    unsigned int result;
+    if(s[0] < 0xC2) {
+        return 0;
+    } else if(s[0] < 0xE0) {
+        length = 2;
+        result = s[0] & 0x1F;
+    } else if(s[0] < 0xF0) {
+        length = 3;
+        result = s[0] & 0x0F;
+        if(s[0] == 0xE0) lo = 0xA0;
+        if(s[0] == 0xED) hi = 0x9F;
+    } else if(s[0] < 0xF5) {
+        length = 4;
+        result = s[0] & 0x07;
+        if(s[0] == 0xF0) lo = 0x90;
+        if(s[0] == 0xF4) hi = 0x8F;
+    } else {
+        return 0;
+    }
+
+    if(count < length) return 0;
+    if(s[1] < lo || s[1] > hi) return 0;
+    result = (result << 6) | (s[1] & 0x3F);
+    for(stg_size_t i = 2; i < length; ++i) {
+        if((s[i] & 0xC0) != 0x80) return 0;
+        result = (result << 6) | (s[i] & 0x3F);
+    }
+    if(codepoint) *codepoint = result;
+    return length;
+}
+
+stg_bool_t stg__utf8_validate_scalar(const stg_byte_t *s, stg_size_t i, stg_size_t count, stg_size_t *error_offset)
+{
+    while(i < count) {
+        // ASCII fast path, 8 bytes at a time
+        while(i + 8 <= count) {
+            stg_size_t word = 0;
+            for(stg_size_t k = 0; k < 8; ++k) word |= STG_CAST(stg_size_t, s[i + k]) << (k * 8);
+            if(word & 0x8080808080808080ULL) break;
+            i += 8;
+        }
+        if(i >= count) break;
+        if(s[i] < 0x80) {
+            i += 1;
+            continue;
+        }
+
+        stg_size_t length = stg_utf8_decode(STG_CAST(const char *, s + i), count - i, STG_NULL);
+        if(length == 0) {
+            if(error_offset) *error_offset = i;
+            return STG_FALSE;
+        }
+        i += length;
+    }
+    return STG_TRUE;
+}
+
+// The vector validator only tells that a block has an error. The scalar one finds it again
+// starting from the last code point boundary before the block, which is the first byte
+// that is not a continuation among the 3 before it.
+stg_bool_t stg__utf8_locate_error(const stg_byte_t *s, stg_size_t block, stg_size_t count, stg_size_t *error_offset)
+{
+    stg_size_t i = block >= 3 ? block - 3 : 0;
+    while(i < block && (s[i] & 0xC0) == 0x80) i += 1;
+    return stg__utf8_validate_scalar(s, i, count, error_offset);
+}
+
+#if defined(__x86_64__) && (defined(STG_COMPILER_GCC) || defined(STG_COMPILER_CLANG))
+#define STG__UTF8_SSSE3
+#include <tmmintrin.h>
+
+// Keiser and Lemire's validator: every byte is checked against the one to three bytes
+// before it with three nibble lookups, which flags all errors of two byte windows, and
+// the bytes that must be the 2nd or 3rd continuation of a sequence are computed apart.
+#define STG__UTF8_TOO_SHORT      (1 << 0)
+#define STG__UTF8_TOO_LONG       (1 << 1)
+#define STG__UTF8_OVERLONG_3     (1 << 2)
+#define STG__UTF8_TOO_LARGE      (1 << 3)
+#define STG__UTF8_SURROGATE      (1 << 4)
+#define STG__UTF8_OVERLONG_2     (1 << 5)
+#define STG__UTF8_TOO_LARGE_1000 (1 << 6)
+#define STG__UTF8_OVERLONG_4     (1 << 6)
+#define STG__UTF8_TWO_CONTS      (1 << 7)
+#define STG__UTF8_CARRY          (STG__UTF8_TOO_SHORT | STG__UTF8_TOO_LONG | STG__UTF8_TWO_CONTS)
+
+typedef struct stg__utf8_tables {
+    __m128i byte_1_high, byte_1_low, byte_2_high;
+} stg__utf8_tables;
+
+// Error bits of `input` given the block before it
+__attribute__((target("ssse3")))
+static inline __m128i stg__utf8_check_block(const stg__utf8_tables *tables, __m128i input, __m128i prev)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+    __m128i special_cases = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(tables->byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+            _mm_shuffle_epi8(tables->byte_1_low, _mm_and_si128(prev1, nibble))),
+        _mm_shuffle_epi8(tables->byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+    __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(STG_CAST(char, 0xE0 - 0x80)));
+    __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(STG_CAST(char, 0xF0 - 0x80)));
+    __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(STG_CAST(char, 0x80)));
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+// Start of the first block the vector checks flag, `count` when there is none
+__attribute__((target("ssse3")))
+stg_size_t stg__utf8_error_block_ssse3(const stg_byte_t *s, stg_size_t count)
+{
+    stg__utf8_tables tables;
+    tables.byte_1_high = _mm_setr_epi8(
+        STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG,
+        STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG, STG__UTF8_TOO_LONG,
+        STG__UTF8_TWO_CONTS, STG__UTF8_TWO_CONTS, STG__UTF8_TWO_CONTS, STG__UTF8_TWO_CONTS,
+        STG__UTF8_TOO_SHORT | STG__UTF8_OVERLONG_2,
+        STG__UTF8_TOO_SHORT,
+        STG__UTF8_TOO_SHORT | STG__UTF8_OVERLONG_3 | STG__UTF8_SURROGATE,
+        STG__UTF8_TOO_SHORT | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000 | STG__UTF8_OVERLONG_4);
+    tables.byte_1_low = _mm_setr_epi8(
+        STG__UTF8_CARRY | STG__UTF8_OVERLONG_3 | STG__UTF8_OVERLONG_2 | STG__UTF8_OVERLONG_4,
+        STG__UTF8_CARRY | STG__UTF8_OVERLONG_2,
+        STG__UTF8_CARRY,
+        STG__UTF8_CARRY,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000 | STG__UTF8_SURROGATE,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000,
+        STG__UTF8_CARRY | STG__UTF8_TOO_LARGE | STG__UTF8_TOO_LARGE_1000);
+    tables.byte_2_high = _mm_setr_epi8(
+        STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT,
+        STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT,
+        STG__UTF8_TOO_LONG | STG__UTF8_OVERLONG_2 | STG__UTF8_TWO_CONTS | STG__UTF8_OVERLONG_3 | STG__UTF8_TOO_LARGE_1000 | STG__UTF8_OVERLONG_4,
+        STG__UTF8_TOO_LONG | STG__UTF8_OVERLONG_2 | STG__UTF8_TWO_CONTS | STG__UTF8_OVERLONG_3 | STG__UTF8_TOO_LARGE,
+        STG__UTF8_TOO_LONG | STG__UTF8_OVERLONG_2 | STG__UTF8_TWO_CONTS | STG__UTF8_SURROGATE | STG__UTF8_TOO_LARGE,
+        STG__UTF8_TOO_LONG | STG__UTF8_OVERLONG_2 | STG__UTF8_TWO_CONTS | STG__UTF8_SURROGATE | STG__UTF8_TOO_LARGE,
+        STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT, STG__UTF8_TOO_SHORT);
+    // A block ending with a lead byte needs continuations from the next one
+    const __m128i incomplete_max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        STG_CAST(char, 0xF0 - 1), STG_CAST(char, 0xE0 - 1), STG_CAST(char, 0xC0 - 1));
+    const __m128i zero = _mm_setzero_si128();
+
+    // Errors are only looked at once per 64 bytes, pure ASCII chunks skip the checks
+    __m128i prev = zero, prev_incomplete = zero;
+    stg_size_t i = 0;
+    for(; i + 64 <= count; i += 64) {
+        __m128i a = _mm_loadu_si128(STG_CAST(const __m128i *, s + i));
+        __m128i b = _mm_loadu_si128(STG_CAST(const __m128i *, s + i + 16));
+        __m128i c = _mm_loadu_si128(STG_CAST(const __m128i *, s + i + 32));
+        __m128i d = _mm_loadu_si128(STG_CAST(const __m128i *, s + i + 48));
+        __m128i error = prev_incomplete;
+        if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+            error = _mm_or_si128(
+                _mm_or_si128(stg__utf8_check_block(&tables, a, prev), stg__utf8_check_block(&tables, b, a)),
+                _mm_or_si128(stg__utf8_check_block(&tables, c, b), stg__utf8_check_block(&tables, d, c)));
+            prev_incomplete = _mm_subs_epu8(d, incomplete_max);
+        }
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF) return i;
+        prev = d;
+    }
+
+    // Every tail block is checked against the one before it, which already flags a sequence
+    // the previous block left open, and zero padding is ASCII, so a sequence cut by the end
+    // shows up as too short. Only a full last block can end on an open sequence.
+    for(; i < count; i += 16) {
+        stg_byte_t block[16] = {0};
+        for(stg_size_t k = 0; k < 16 && i + k < count; ++k) block[k] = s[i + k];
+        __m128i input = _mm_loadu_si128(STG_CAST(const __m128i *, block));
+        __m128i error = stg__utf8_check_block(&tables, input, prev);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF) return i;
+        prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+        prev = input;
+    }
+
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(prev_incomplete, zero)) != 0xFFFF) return count >= 3 ? count - 3 : 0;
+    return count;
+}
+
+stg_bool_t stg__utf8_validate_ssse3(const stg_byte_t *s, stg_size_t count, stg_size_t *error_offset)
+{
+    stg_size_t block = stg__utf8_error_block_ssse3(s, count);
+    if(block == count) return STG_TRUE;
+    return stg__utf8_locate_error(s, block, count, error_offset);
+}
+#endif // x86_64 GCC or Clang
+
+stg_bool_t stg_utf8_validate(const char *data, stg_size_t count, stg_size_t *error_offset)
+{
+    const stg_byte_t *s = STG_CAST(const stg_byte_t *, data);
+#ifdef STG__UTF8_SSSE3
+    if(__builtin_cpu_supports("ssse3")) return stg__utf8_validate_ssse3(s, count, error_offset);
+#endif // STG__UTF8_SSSE3
+    return stg__utf8_validate_scalar(s, 0, count, error_offset);
+}
+
 void stg_string_format(char *dst, stg_size_t dst_capacity, const char *fmt, ...)
 {
 }
@@ -246,6 +603,505 @@ stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t en
     };
 }
 
+/************************
+ * Job system
+ ************************/
+#ifdef STG_HAS_JOB_SYSTEM
+typedef struct stg__job {
+    stg_job_proc proc;
+    void *user_data;
+    stg_job_counter *counter;
+} stg__job;
+
+// Chase-Lev deque, the owner pushes and takes at the bottom while other workers steal
+// from the top. Jobs are copied field by field with relaxed atomics since a thief may
+// read a slot that the owner is overwriting, the copy is only used if its CAS on top wins.
+typedef struct stg__job_worker {
+    long long top;
+    char top_padding[64 - sizeof(long long)];
+    long long bottom;
+    char bottom_padding[64 - sizeof(long long)];
+    stg__job jobs[STG_JOB_QUEUE_CAPACITY];
+    stg_job_system *system;
+    stg_platform_thread thread;
+    stg_size_t random;
+} stg__job_worker;
+
+struct stg_job_system {
+    stg__job_worker *workers;
+    stg_size_t worker_count;
+    // Worker of the creating thread before this system took it over, restored on destroy
+    stg__job_worker *previous_worker;
+    int running;
+    int sleepers;
+    int wake_epoch;
+};
+
+static STG_THREAD_LOCAL stg__job_worker *stg__current_job_worker = STG_NULL;
+
+void stg__job_store(stg__job *slot, stg__job job)
+{
+    stg_atomic_store_relaxed(&slot->proc, job.proc);
+    stg_atomic_store_relaxed(&slot->user_data, job.user_data);
+    stg_atomic_store_relaxed(&slot->counter, job.counter);
+}
+
+stg__job stg__job_load(stg__job *slot)
+{
+    stg__job job;
+    job.proc = stg_atomic_load_relaxed(&slot->proc);
+    job.user_data = stg_atomic_load_relaxed(&slot->user_data);
+    job.counter = stg_atomic_load_relaxed(&slot->counter);
+    return job;
+}
+
+stg_bool_t stg__job_push(stg__job_worker *worker, stg__job job)
+{
+    long long bottom = stg_atomic_load_relaxed(&worker->bottom);
+    long long top = stg_atomic_load(&worker->top);
+    if(bottom - top >= STG_JOB_QUEUE_CAPACITY) return STG_FALSE;
+
+    stg__job_store(&worker->jobs[bottom & (STG_JOB_QUEUE_CAPACITY - 1)], job);
+    stg_atomic_store(&worker->bottom, bottom + 1);
+    return STG_TRUE;
+}
+
+stg_bool_t stg__job_take(stg__job_worker *worker, stg__job *job)
+{
+    long long bottom = stg_atomic_load_relaxed(&worker->bottom) - 1;
+    stg_atomic_store_relaxed(&worker->bottom, bottom);
+    stg_atomic_fence();
+    long long top = stg_atomic_load_relaxed(&worker->top);
+    if(top > bottom) {
+        stg_atomic_store_relaxed(&worker->bottom, bottom + 1);
+        return STG_FALSE;
+    }
+
+    *job = stg__job_load(&worker->jobs[bottom & (STG_JOB_QUEUE_CAPACITY - 1)]);
+    if(top == bottom) {
+        // Last job, race the thieves for it
+        stg_bool_t won = stg_atomic_cas(&worker->top, top, top + 1);
+        stg_atomic_store_relaxed(&worker->bottom, bottom + 1);
+        return won;
+    }
+    return STG_TRUE;
+}
+
+stg_bool_t stg__job_steal(stg__job_worker *worker, stg__job *job)
+{
+    long long top = stg_atomic_load(&worker->top);
+    stg_atomic_fence();
+    long long bottom = stg_atomic_load(&worker->bottom);
+    if(top >= bottom) return STG_FALSE;
+
+    *job = stg__job_load(&worker->jobs[top & (STG_JOB_QUEUE_CAPACITY - 1)]);
+    return stg_atomic_cas(&worker->top, top, top + 1);
+}
+
+stg_bool_t stg__job_find(stg_job_system *system, stg__job_worker *self, stg__job *job)
+{
+    if(stg__job_take(self, job)) return STG_TRUE;
+
+    self->random ^= self->random << 13;
+    self->random ^= self->random >> 7;
+    self->random ^= self->random << 17;
+    stg_size_t start = self->random % system->worker_count;
+    for(stg_size_t i = 0; i < system->worker_count; ++i) {
+        stg__job_worker *victim = &system->workers[(start + i) % system->worker_count];
+        if(victim != self && stg__job_steal(victim, job)) return STG_TRUE;
+    }
+    return STG_FALSE;
+}
+
+void stg__job_execute(stg__job job)
+{
+    job.proc(job.user_data);
+    if(job.counter && stg_atomic_add(&job.counter->value, -1) == 0) {
+        stg_platform_futex_wake(&job.counter->value, 0x7fffffff);
+    }
+}
+
+// Number of empty polls before a thread goes to sleep
+#define STG__JOB_SPIN_COUNT 64
+
+void stg__job_worker_main(void *user_data)
+{
+    stg__job_worker *self = user_data;
+    stg_job_system *system = self->system;
+    stg__current_job_worker = self;
+
+    stg_size_t idle = 0;
+    stg__job job;
+    while(stg_atomic_load(&system->running)) {
+        if(stg__job_find(system, self, &job)) {
+            stg__job_execute(job);
+            idle = 0;
+            continue;
+        }
+        if(++idle < STG__JOB_SPIN_COUNT) {
+            stg_platform_thread_yield();
+            continue;
+        }
+
+        // Announce the sleep before the last look for work, stg_job_run checks sleepers
+        // after pushing so one of the two always sees the other
+        int epoch = stg_atomic_load(&system->wake_epoch);
+        stg_atomic_add(&system->sleepers, 1);
+        if(stg__job_find(system, self, &job)) {
+            stg_atomic_add(&system->sleepers, -1);
+            stg__job_execute(job);
+            idle = 0;
+            continue;
+        }
+        if(stg_atomic_load(&system->running)) stg_platform_futex_wait(&system->wake_epoch, epoch);
+        stg_atomic_add(&system->sleepers, -1);
+    }
+}
+
+stg_job_system *stg_job_system_create(stg_size_t worker_count)
+{
+    if(worker_count == 0) worker_count = stg_platform_processor_count();
+    if(worker_count == 0) worker_count = 1;
+
+    stg_job_system *system = stg_malloc(sizeof(*system));
+    if(!system) return STG_NULL;
+    stg_memset(system, 0, sizeof(*system));
+    system->workers = stg_malloc(worker_count * sizeof(*system->workers));
+    if(!system->workers) {
+        stg_free(system);
+        return STG_NULL;
+    }
+    stg_memset(system->workers, 0, worker_count * sizeof(*system->workers));
+    system->worker_count = worker_count;
+    system->running = 1;
+
+    for(stg_size_t i = 0; i < worker_count; ++i) {
+        system->workers[i].system = system;
+        system->workers[i].random = 0x9e3779b97f4a7c15ULL * (i + 1);
+    }
+
+    // The calling thread is worker 0, it works while waiting on counters
+    system->previous_worker = stg__current_job_worker;
+    stg__current_job_worker = &system->workers[0];
+    for(stg_size_t i = 1; i < worker_count; ++i) {
+        if(!stg_platform_thread_create(&system->workers[i].thread, stg__job_worker_main, &system->workers[i])) {
+            system->worker_count = i;
+            break;
+        }
+    }
+    return system;
+}
+
+void stg_job_system_destroy(stg_job_system *system)
+{
+    if(!system) return;
+    stg_atomic_store(&system->running, 0);
+    stg_atomic_add(&system->wake_epoch, 1);
+    stg_platform_futex_wake(&system->wake_epoch, 0x7fffffff);
+    for(stg_size_t i = 1; i < system->worker_count; ++i) {
+        stg_platform_thread_join(system->workers[i].thread);
+    }
+    if(stg__current_job_worker == &system->workers[0]) stg__current_job_worker = system->previous_worker;
+    stg_free(system->workers);
+    stg_free(system);
+}
+
+stg_size_t stg_job_system_worker_count(stg_job_system *system)
+{
+    return system->worker_count;
+}
+
+void stg_job_run(stg_job_system *system, stg_job_proc proc, void *user_data, stg_job_counter *counter)
+{
+    stg__job job;
+    job.proc = proc;
+    job.user_data = user_data;
+    job.counter = counter;
+    if(counter) stg_atomic_add(&counter->value, 1);
+
+    stg__job_worker *self = stg__current_job_worker;
+    if(!self || self->system != system || !stg__job_push(self, job)) {
+        stg__job_execute(job);
+        return;
+    }
+
+    stg_atomic_fence();
+    if(stg_atomic_load_relaxed(&system->sleepers) > 0) {
+        stg_atomic_add(&system->wake_epoch, 1);
+        stg_platform_futex_wake(&system->wake_epoch, 1);
+    }
+}
+
+void stg_job_wait(stg_job_system *system, stg_job_counter *counter)
+{
+    stg__job_worker *self = stg__current_job_worker;
+    if(self && self->system != system) self = STG_NULL;
+
+    stg_size_t idle = 0;
+    stg__job job;
+    int value;
+    while((value = stg_atomic_load(&counter->value)) != 0) {
+        if(self && stg__job_find(system, self, &job)) {
+            stg__job_execute(job);
+            idle = 0;
+            continue;
+        }
+        if(++idle < STG__JOB_SPIN_COUNT) {
+            stg_platform_thread_yield();
+            continue;
+        }
+        // Woken by the job that brings the counter to zero
+        stg_platform_futex_wait(&counter->value, value);
+    }
+}
+
+typedef struct stg__job_range {
+    stg_job_range_proc proc;
+    void *user_data;
+    stg_size_t begin, end;
+} stg__job_range;
+
+void stg__job_range_main(void *user_data)
+{
+    stg__job_range *range = user_data;
+    range->proc(range->user_data, range->begin, range->end);
+}
+
+void stg_job_parallel_for(stg_job_system *system, stg_size_t count, stg_size_t grain, stg_job_range_proc proc, void *user_data)
+{
+    if(count == 0) return;
+    if(grain == 0) grain = 1;
+    // Keep every chunk in the queue instead of running the overflow on this thread
+    while((count + grain - 1) / grain > STG_JOB_QUEUE_CAPACITY / 2) grain *= 2;
+
+    stg_size_t range_count = (count + grain - 1) / grain;
+    stg__job_range *ranges = stg_malloc(range_count * sizeof(*ranges));
+    if(!ranges) {
+        proc(user_data, 0, count);
+        return;
+    }
+
+    stg_job_counter counter = {0};
+    for(stg_size_t i = 0; i < range_count; ++i) {
+        ranges[i].proc = proc;
+        ranges[i].user_data = user_data;
+        ranges[i].begin = i * grain;
+        ranges[i].end = STG_MIN(count, (i + 1) * grain);
+        stg_job_run(system, stg__job_range_main, &ranges[i], &counter);
+    }
+    stg_job_wait(system, &counter);
+    stg_free(ranges);
+}
+#endif // STG_HAS_JOB_SYSTEM
+
+/************************
+ * Profiling
+ ************************/
+#ifdef STG_HAS_ATOMICS
+typedef struct stg__profile_buffer {
+    struct stg__profile_buffer *next;
+    stg_size_t thread_index;
+    // Clock sample taken at creation and the tick rate, used to convert ticks to nanoseconds.
+    // Both are fixed so that exporting the same zones twice gives the same trace.
+    stg_size_t origin_ticks, origin_ns;
+    double ns_per_tick;
+    // Zones [start, count) are recorded, zone i lives in zones[i % STG_PROFILE_BUFFER_CAPACITY].
+    // Only the owning thread writes `count` and `dropped`, it publishes `count` after the zone it
+    // covers. stg_profile_reset moves `start` up to `count`, which frees the slots for reuse.
+    stg_size_t start, count;
+    stg_size_t dropped, dropped_at_reset;
+    stg_profile_zone zones[STG_PROFILE_BUFFER_CAPACITY];
+} stg__profile_buffer;
+
+// Buffers are only ever pushed at the front, so readers can walk the list at any time
+static stg__profile_buffer *stg__profile_buffers = STG_NULL;
+static stg_size_t stg__profile_thread_count = 0;
+static STG_THREAD_LOCAL stg__profile_buffer *stg__profile_current = STG_NULL;
+// 0 before calibration, 1 while a thread calibrates, 2 once stg__profile_calibrated_ns_per_tick is set
+static int stg__profile_calibration = 0;
+static double stg__profile_calibrated_ns_per_tick = 1.0;
+
+// Spent once per process, by the first thread that records a zone
+#define STG__PROFILE_CALIBRATION_NS 1000000
+
+stg_size_t stg_profile_ticks(void)
+{
+#if defined(__x86_64__) && (defined(STG_COMPILER_CLANG) || defined(STG_COMPILER_GCC))
+    return __builtin_ia32_rdtsc();
+#else
+    return stg_platform_get_time_ns();
+#endif
+}
+
+double stg__profile_ns_per_tick(void)
+{
+#if defined(__x86_64__) && (defined(STG_COMPILER_CLANG) || defined(STG_COMPILER_GCC))
+    int expected = 0;
+    if(stg_atomic_cas(&stg__profile_calibration, expected, 1)) {
+        stg_size_t start_ticks = stg_profile_ticks();
+        stg_size_t start_ns = stg_platform_get_time_ns();
+        stg_size_t now_ns = start_ns;
+        while(now_ns - start_ns < STG__PROFILE_CALIBRATION_NS) now_ns = stg_platform_get_time_ns();
+        stg_size_t ticks = stg_profile_ticks() - start_ticks;
+        if(ticks > 0) stg__profile_calibrated_ns_per_tick = STG_CAST(double, now_ns - start_ns) / STG_CAST(double, ticks);
+        stg_atomic_store(&stg__profile_calibration, 2);
+    }
+    while(stg_atomic_load(&stg__profile_calibration) != 2) stg_platform_thread_yield();
+    return stg__profile_calibrated_ns_per_tick;
+#else
+    return 1.0;
+#endif
+}
+
+// The platform heap is used directly since stg_malloc itself has a zone
+stg__profile_buffer *stg__profile_thread_buffer(void)
+{
+    if(stg__profile_current) return stg__profile_current;
+
+    stg__profile_buffer *buffer = stg_platform_heap_alloc(sizeof(stg__profile_buffer));
+    if(!buffer) return STG_NULL;
+    buffer->thread_index = stg_atomic_add(&stg__profile_thread_count, 1);
+    buffer->ns_per_tick = stg__profile_ns_per_tick();
+    buffer->origin_ticks = stg_profile_ticks();
+    buffer->origin_ns = stg_platform_get_time_ns();
+    buffer->start = 0;
+    buffer->count = 0;
+    buffer->dropped = 0;
+    buffer->dropped_at_reset = 0;
+
+    stg__profile_buffer *head = stg_atomic_load(&stg__profile_buffers);
+    do {
+        buffer->next = head;
+    } while(!stg_atomic_cas(&stg__profile_buffers, head, buffer));
+    stg__profile_current = buffer;
+    return buffer;
+}
+
+void stg_profile_zone_end(stg_profile_zone *zone)
+{
+    zone->end = stg_profile_ticks();
+    stg__profile_buffer *buffer = stg__profile_thread_buffer();
+    if(!buffer) return;
+
+    stg_size_t count = buffer->count;
+    if(count - stg_atomic_load(&buffer->start) >= STG_PROFILE_BUFFER_CAPACITY) {
+        stg_atomic_store_relaxed(&buffer->dropped, buffer->dropped + 1);
+        return;
+    }
+    buffer->zones[count % STG_PROFILE_BUFFER_CAPACITY] = *zone;
+    stg_atomic_store(&buffer->count, count + 1);
+}
+
+stg_size_t stg_profile_dropped_zones(void)
+{
+    stg_size_t dropped = 0;
+    for(stg__profile_buffer *buffer = stg_atomic_load(&stg__profile_buffers); buffer; buffer = buffer->next) 
+        dropped += stg_atomic_load_relaxed(&buffer->dropped) - stg_atomic_load_relaxed(&buffer->dropped_at_reset);
+    return dropped;
+}
+
+void stg_profile_reset(void)
+{
+    for(stg__profile_buffer *buffer = stg_atomic_load(&stg__profile_buffers); buffer; buffer = buffer->next) {
+        stg_atomic_store_relaxed(&buffer->dropped_at_reset, stg_atomic_load_relaxed(&buffer->dropped));
+        stg_atomic_store(&buffer->start, stg_atomic_load(&buffer->count));
+    }
+}
+
+typedef struct stg__profile_writer {
+    char *data;
+    stg_size_t capacity, count;
+} stg__profile_writer;
+
+void stg__profile_write_char(stg__profile_writer *writer, char c)
+{
+    if(writer->count < writer->capacity) writer->data[writer->count] = c;
+    writer->count += 1;
+}
+
+void stg__profile_write_cstr(stg__profile_writer *writer, const char *cstr)
+{
+    while(*cstr) stg__profile_write_char(writer, *cstr++);
+}
+
+void stg__profile_write_uint(stg__profile_writer *writer, stg_size_t value)
+{
+    char digits[20];
+    stg_size_t count = 0;
+    do {
+        digits[count++] = STG_CAST(char, '0' + value % 10);
+        value /= 10;
+    } while(value > 0);
+    while(count > 0) stg__profile_write_char(writer, digits[--count]);
+}
+
+// Trace event times are in microseconds
+void stg__profile_write_us(stg__profile_writer *writer, stg_size_t ns)
+{
+    stg__profile_write_uint(writer, ns / 1000);
+    stg__profile_write_char(writer, '.');
+    stg__profile_write_char(writer, STG_CAST(char, '0' + ns / 100 % 10));
+    stg__profile_write_char(writer, STG_CAST(char, '0' + ns / 10 % 10));
+    stg__profile_write_char(writer, STG_CAST(char, '0' + ns % 10));
+}
+
+// Zones may have started before their buffer was created, hence the signed difference
+stg_size_t stg__profile_ticks_to_ns(stg__profile_buffer *buffer, stg_size_t ticks)
+{
+    double delta = STG_CAST(double, STG_CAST(long long, ticks - buffer->origin_ticks)) * buffer->ns_per_tick;
+    return STG_CAST(stg_size_t, STG_CAST(long long, buffer->origin_ns) + STG_CAST(long long, delta));
+}
+
+stg_size_t stg_profile_export_chrome_trace(char *buffer, stg_size_t capacity)
+{
+    stg__profile_writer writer = { buffer, capacity, 0 };
+    stg__profile_buffer *head = stg_atomic_load(&stg__profile_buffers);
+
+    // Times are written relative to the earliest zone
+    stg_size_t base_ns = STG_CAST(stg_size_t, -1);
+    for(stg__profile_buffer *profile = head; profile; profile = profile->next) {
+        stg_size_t count = stg_atomic_load(&profile->count);
+        for(stg_size_t i = stg_atomic_load(&profile->start); i < count; ++i) {
+            const stg_profile_zone *zone = &profile->zones[i % STG_PROFILE_BUFFER_CAPACITY];
+            stg_size_t start = stg__profile_ticks_to_ns(profile, zone->start);
+            if(start < base_ns) base_ns = start;
+        }
+    }
+
+    stg__profile_write_cstr(&writer, "{\"traceEvents\":[");
+    stg_bool_t first = STG_TRUE;
+    for(stg__profile_buffer *profile = head; profile; profile = profile->next) {
+        // Zones published after the first pass are left out, they could start before base_ns
+        stg_size_t count = stg_atomic_load(&profile->count);
+        for(stg_size_t i = stg_atomic_load(&profile->start); i < count; ++i) {
+            const stg_profile_zone *zone = &profile->zones[i % STG_PROFILE_BUFFER_CAPACITY];
+            stg_size_t start = stg__profile_ticks_to_ns(profile, zone->start);
+            stg_size_t end = stg__profile_ticks_to_ns(profile, zone->end);
+            if(start < base_ns) continue;
+
+            if(!first) stg__profile_write_char(&writer, ',');
+            first = STG_FALSE;
+            stg__profile_write_cstr(&writer, "\n{\"name\":\"");
+            for(const char *c = zone->name; *c; ++c) {
+                if(*c == '"' || *c == '\\') stg__profile_write_char(&writer, '\\');
+                stg__profile_write_char(&writer, STG_CAST(unsigned char, *c) < 0x20 ? ' ' : *c);
+            }
+            stg__profile_write_cstr(&writer, "\",\"ph\":\"X\",\"ts\":");
+            stg__profile_write_us(&writer, start - base_ns);
+            stg__profile_write_cstr(&writer, ",\"dur\":");
+            stg__profile_write_us(&writer, end > start ? end - start : 0);
+            stg__profile_write_cstr(&writer, ",\"pid\":0,\"tid\":");
+            stg__profile_write_uint(&writer, profile->thread_index);
+            stg__profile_write_char(&writer, '}');
+        }
+    }
+    stg__profile_write_cstr(&writer, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+    if(writer.count < capacity) buffer[writer.count] = '\0';
+    return writer.count;
+}
+#endif // STG_HAS_ATOMICS
+
 /************************
  * Platform dependent API 
  ************************/
@@ -256,6 +1112,12 @@ stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t en
 #ifdef STG_PLATFORM_LINUX
     #include <stdlib.h>
     #include <stdio.h>
+    #include <time.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
     void stg_platform_console_write(const char *message) {
         fprintf(stdout, "%s", message);
     }
@@ -273,6 +1135,78 @@ stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t en
     void stg_platform_heap_free(void *ptr){
         if(ptr) free(ptr);
     }
+
+    void stg_tracelog(stg_log_level level, const char *fmt, ...) {
+        static const char *prefixes[] = { "INFO", "WARNING", "ERROR" };
+        FILE *stream = level == STG_LOG_INFO ? stdout : stderr;
+        va_list ap;
+        va_start(ap, fmt);
+        fprintf(stream, "[%s] ", prefixes[level]);
+        vfprintf(stream, fmt, ap);
+        fprintf(stream, "\n");
+        va_end(ap);
+    }
+
+#ifndef NDEBUG
+    void __stg_report_assertion_failure(const char *file, int line, const char *reason) {
+        fprintf(stderr, "%s:%d: Assertion failed: %s\n", file, line, reason);
+        abort();
+    }
+#endif // NDEBUG
+
+    stg_size_t stg_platform_get_time_ns(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return STG_CAST(stg_size_t, ts.tv_sec) * 1000000000ULL + STG_CAST(stg_size_t, ts.tv_nsec);
+    }
+
+    typedef struct stg__linux_thread_start {
+        stg_platform_thread_proc proc;
+        void *user_data;
+    } stg__linux_thread_start;
+
+    static void *stg__linux_thread_main(void *user_data) {
+        stg__linux_thread_start start = *STG_CAST(stg__linux_thread_start *, user_data);
+        free(user_data);
+        start.proc(start.user_data);
+        return NULL;
+    }
+
+    stg_bool_t stg_platform_thread_create(stg_platform_thread *thread, stg_platform_thread_proc proc, void *user_data) {
+        stg__linux_thread_start *start = malloc(sizeof(*start));
+        if(!start) return STG_FALSE;
+        start->proc = proc;
+        start->user_data = user_data;
+
+        pthread_t handle;
+        if(pthread_create(&handle, NULL, stg__linux_thread_main, start) != 0) {
+            free(start);
+            return STG_FALSE;
+        }
+        thread->handle = STG_CAST(stg_size_t, handle);
+        return STG_TRUE;
+    }
+
+    void stg_platform_thread_join(stg_platform_thread thread) {
+        pthread_join(STG_CAST(pthread_t, thread.handle), NULL);
+    }
+
+    void stg_platform_thread_yield(void) {
+        sched_yield();
+    }
+
+    stg_size_t stg_platform_processor_count(void) {
+        long count = sysconf(_SC_NPROCESSORS_ONLN);
+        return count > 0 ? STG_CAST(stg_size_t, count) : 1;
+    }
+
+    void stg_platform_futex_wait(int *address, int expected) {
+        syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+    }
+
+    void stg_platform_futex_wake(int *address, int count) {
+        syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+    }
 #endif // STG_PLATFORM_LINUX
 
 #endif // STG_IMPLEMENTATION
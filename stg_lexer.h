@@ -4,11 +4,58 @@
  * ```c
  * #define STG_WITHOUT_STANDARD_LIBRARY
  *
- * // Implement this 2 function
+ * // Implement this 7 function
  * char *stg_lexer_load_file_text(const char *file_path);
  * void stg_lexer_unload_file_text(char *return_value_of_stg_lexer_load_file_text);
+ * void *stg_lexer_alloc_memory(stg_size_t size);
+ * void stg_lexer_free_memory(void *ptr);
+ * const void *stg_lexer_map_file_data(const char *file_path, stg_size_t *size);
+ * void stg_lexer_unmap_file_data(const void *return_value_of_stg_lexer_map_file_data, stg_size_t size);
+ * stg_bool_t stg_lexer_save_file_data(const char *file_path, const void *data, stg_size_t size);
  * ```
  *
+ * To only replace the allocator and keep the other standard library hooks do this
+ * ```c
+ * #define STG_LEXER_CUSTOM_ALLOCATOR
+ *
+ * // Implement this 2 function
+ * void *stg_lexer_alloc_memory(stg_size_t size);
+ * void stg_lexer_free_memory(void *ptr);
+ * ```
+ *
+ * Lookahead tokens are kept in a ring buffer that starts with
+ * STG_LEXER_TOKENS_CACHE_CAPACITY slots and grows as needed, so `stg_lexer_peek`
+ * can look arbitrarily far ahead. For speculative parsing take a mark with
+ * `stg_lexer_mark`, rewind to it with `stg_lexer_reset` as many times as needed
+ * and give it back with `stg_lexer_release`. Marks must be released in reverse
+ * order of creation.
+ *
+ * The set of operators, comment delimiters, string quotes and escape character comes from
+ * a `stg_lexer_config` given to `stg_lexer_init_with_config`, `stg_lexer_default_config`
+ * is used otherwise. It is compiled at init into character class and operator transition
+ * tables, operators are matched longest first and comments are skipped like whitespace.
+ *
+ * Sources must be valid UTF-8, init fails otherwise unless the config sets
+ * `allow_invalid_utf8`, then malformed bytes are lexed as one byte symbols. Identifiers
+ * start with an XID_Start code point and continue with XID_Continue ones on top of the
+ * ASCII letters, digits and `identifier_chars`. Columns count code points, not bytes.
+ *
+ * When stg.h is included first and STG_PROFILE is defined, lexer init, whole source
+ * tokenization, relexing and the default file loading and allocation hooks are recorded
+ * as profiling zones, see stg_profile_zone. Single tokens are not, a zone costs about as
+ * much as lexing one.
+ *
+ * Numbers accept `0x`, `0b` and `0o` prefixes, `_` digit separators, exponents and
+ * any alphanumeric suffix (`10u`, `1.5f`). Their value is parsed while lexing and stored
+ * in the token unless STG_LEXER_WITHOUT_NUMBER_VALUES is defined, the same parsing is
+ * available through `stg_lexer_parse_integer` and `stg_lexer_parse_float`.
+ *
+ * A lexed source can be saved with `stg_lexer_token_cache_write` and read back on the
+ * next run with `stg_lexer_token_cache_open` + `stg_lexer_token_cache_next`, which map
+ * the cache file and hand out tokens without lexing. Opening fails when the source or the
+ * lexer config no longer match the hashes recorded in the cache, or when the file is
+ * malformed, the caller then lexes normally.
+ *
  */
 #ifdef STG_IMPLEMENTATION
 #define STG_LEXER_IMPLEMENTATION
@@ -25,6 +72,9 @@
             #define STG_CLITERAL(T) (T)
         #endif
     #endif
+    #ifndef STG_NULL
+        #define STG_NULL (void *)0
+    #endif // STG_NULL
     #ifndef STG_SWAP
         #define STG_SWAP(T, a, b)   \
             do {                    \
@@ -48,8 +98,14 @@
     #define STG_SV_FMT "%.*s"
     #define STG_SV_ARGV(sv) (int)sv.count, sv.data
     stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t end);
+    stg_bool_t stg_utf8_validate(const char *data, stg_size_t count, stg_size_t *error_offset);
+    stg_size_t stg_utf8_decode(const char *data, stg_size_t count, unsigned int *codepoint);
+    // Profiling needs stg.h
+    #define STG_PROFILE_ZONE(name)
+    #define STG_PROFILE_FUNCTION()
 #endif // STG_INCLUDED
 
+// Initial capacity of the lookahead buffer, must be a power of two
 #ifndef STG_LEXER_TOKENS_CACHE_CAPACITY
 #define STG_LEXER_TOKENS_CACHE_CAPACITY 32
 #endif // STG_LEXER_TOKENS_CACHE_CAPACITY
@@ -79,31 +135,156 @@ typedef struct stg_lexer_token {
     stg_lexer_token_type type;
     stg_string_view literal;
     stg_lexer_token_location location;
+    // Span of the whole lexeme in the source, including delimiters such as quotes
+    stg_size_t offset, length;
+#ifndef STG_LEXER_WITHOUT_NUMBER_VALUES
+    // Parsed value of STG_LEXER_TOKEN_INTEGER and STG_LEXER_TOKEN_FLOAT tokens, has_value is not
+    // set when the literal is malformed or does not fit, or when a float has so many significant
+    // digits that the correctly rounded value cannot be told from the first 19
+    stg_bool_t has_value;
+    union {
+        stg_size_t integer;
+        double floating;
+    } value;
+#endif // STG_LEXER_WITHOUT_NUMBER_VALUES
 } stg_lexer_token;
 
+typedef stg_size_t stg_lexer_mark_t;
+
+// Operators are matched longest first, brackets are always recognized with their own token types
+typedef struct stg_lexer_config {
+    const char **operators;
+    stg_size_t operators_count;
+    const char *line_comment;           // STG_NULL to disable
+    const char *block_comment_start;    // STG_NULL to disable
+    const char *block_comment_end;
+    const char *string_quotes;          // Every char opens and closes its own kind of string
+    char string_escape;                 // Escaped chars never close a string, 0 to disable
+    const char *identifier_chars;       // Allowed in identifiers on top of letters and digits
+    stg_bool_t allow_invalid_utf8;      // Lex malformed UTF-8 bytes as symbols instead of failing
+} stg_lexer_config;
+
+#ifndef STG_LEXER_MAX_OPERATOR_NODES
+#define STG_LEXER_MAX_OPERATOR_NODES 128 // At most 256
+#endif // STG_LEXER_MAX_OPERATOR_NODES
+#ifndef STG_LEXER_MAX_OPERATOR_CHARS
+#define STG_LEXER_MAX_OPERATOR_CHARS 32
+#endif // STG_LEXER_MAX_OPERATOR_CHARS
+#ifndef STG_LEXER_MAX_DELIMITER_LENGTH
+#define STG_LEXER_MAX_DELIMITER_LENGTH 7
+#endif // STG_LEXER_MAX_DELIMITER_LENGTH
+
+// A stg_lexer_config compiled into lookup tables
+typedef struct stg_lexer_table {
+    unsigned char char_class[256];
+    unsigned char char_flags[256];
+    // Operators form a trie over their own alphabet, node 0 is the root and a 0 transition means none
+    unsigned char operator_char[256];
+    unsigned char operator_next[STG_LEXER_MAX_OPERATOR_NODES][STG_LEXER_MAX_OPERATOR_CHARS];
+    unsigned char operator_accept[STG_LEXER_MAX_OPERATOR_NODES];
+    stg_size_t operator_nodes_count;
+    stg_size_t operator_chars_count;
+    char line_comment[STG_LEXER_MAX_DELIMITER_LENGTH + 1];
+    char block_comment_start[STG_LEXER_MAX_DELIMITER_LENGTH + 1];
+    char block_comment_end[STG_LEXER_MAX_DELIMITER_LENGTH + 1];
+    char string_escape;
+    stg_bool_t validate_utf8;
+    // How many chars after a token may have decided where it ends, the longest operator or
+    // comment delimiter
+    stg_size_t lookahead;
+} stg_lexer_table;
+
+// A fully lexed source, tokens literals point into `source`
+typedef struct stg_lexer_tokens {
+    stg_lexer_token *data;
+    stg_size_t count;
+    stg_size_t capacity;
+    stg_string_view source;
+    const stg_lexer_config *config;
+} stg_lexer_tokens;
+
+// Reader of a file written by stg_lexer_token_cache_write
+typedef struct stg_lexer_token_cache {
+    const void *mapping;
+    stg_size_t mapping_size;
+    const char *source;
+    stg_size_t count;
+    stg_size_t next;
+} stg_lexer_token_cache;
+
+// `removed_count` bytes at `offset` of the old source were replaced by
+// `inserted_count` bytes at the same offset of the new source
+typedef struct stg_lexer_edit {
+    stg_size_t offset;
+    stg_size_t removed_count;
+    stg_size_t inserted_count;
+} stg_lexer_edit;
+
 typedef struct stg_lexer {
+    // Indices only ever increase and are mapped to a slot with `index & (capacity - 1)`.
+    // Tokens in [base, head) are buffered, tail is the next token returned by stg_lexer_next
+    // and base only lags behind tail while there are outstanding marks.
     struct {
-        stg_lexer_token data[STG_LEXER_TOKENS_CACHE_CAPACITY];
-        stg_size_t tail, head;
-        stg_bool_t carry;
+        stg_lexer_token *data;
+        stg_size_t capacity;
+        stg_size_t base, tail, head;
+        stg_size_t marks;
     } cache;
     stg_size_t i;
     char cc;
     stg_string_view source;
     stg_lexer_token_location location;
+    stg_size_t token_start;
+    stg_lexer_token_location token_location;
+    stg_lexer_table table;
 } stg_lexer;
 
 char *stg_lexer_load_file_text(const char *file_path);
 void stg_lexer_unload_file_text(char *return_value_of_stg_lexer_load_file_text);
+void *stg_lexer_alloc_memory(stg_size_t size);
+void stg_lexer_free_memory(void *ptr);
+const void *stg_lexer_map_file_data(const char *file_path, stg_size_t *size);
+void stg_lexer_unmap_file_data(const void *return_value_of_stg_lexer_map_file_data, stg_size_t size);
+stg_bool_t stg_lexer_save_file_data(const char *file_path, const void *data, stg_size_t size);
 
+const stg_lexer_config *stg_lexer_default_config(void);
 stg_bool_t stg_lexer_init(stg_lexer *lexer, const char *source);
+stg_bool_t stg_lexer_init_with_config(stg_lexer *lexer, const char *source, const stg_lexer_config *config);
 stg_bool_t stg_lexer_init_from_file(stg_lexer *lexer, const char *file_path);
+// For lexers made with stg_lexer_init_from_file, frees the lookahead buffer and the file text
 void stg_lexer_deinit(stg_lexer lexer);
+// Frees the lookahead buffer only, for lexers over a source owned by the caller.
+// Tokens that were peeked but not consumed yet are discarded along with it.
+void stg_lexer_free_lookahead(stg_lexer *lexer);
 stg_bool_t stg_lexer_peek(stg_lexer *lexer, stg_lexer_token *token, stg_size_t index);
 stg_bool_t stg_lexer_next(stg_lexer *lexer, stg_lexer_token *token);
+stg_lexer_mark_t stg_lexer_mark(stg_lexer *lexer);
+void stg_lexer_reset(stg_lexer *lexer, stg_lexer_mark_t mark);
+void stg_lexer_release(stg_lexer *lexer, stg_lexer_mark_t mark);
+
+stg_bool_t stg_lexer_tokens_init(stg_lexer_tokens *tokens, const char *source);
+// `config` must outlive `tokens`, it is used again by stg_lexer_tokens_relex
+stg_bool_t stg_lexer_tokens_init_with_config(stg_lexer_tokens *tokens, const char *source, const stg_lexer_config *config);
+void stg_lexer_tokens_deinit(stg_lexer_tokens *tokens);
+// Update `tokens` after `edit` was applied to its source, producing `new_source` (which may
+// be the same buffer edited in place). Only the tokens around the edit are lexed again, the
+// tokens after it are shifted once the new token stream lines up with the old one.
+stg_bool_t stg_lexer_tokens_relex(stg_lexer_tokens *tokens, const char *new_source, stg_lexer_edit edit);
+
+stg_bool_t stg_lexer_token_cache_write(const char *cache_path, const stg_lexer_tokens *tokens);
+stg_bool_t stg_lexer_token_cache_open(stg_lexer_token_cache *cache, const char *cache_path, const char *source);
+// `config` must be the one the cached tokens were lexed with, STG_NULL for the default one
+stg_bool_t stg_lexer_token_cache_open_with_config(stg_lexer_token_cache *cache, const char *cache_path,
+        const char *source, const stg_lexer_config *config);
+stg_bool_t stg_lexer_token_cache_next(stg_lexer_token_cache *cache, stg_lexer_token *token);
+void stg_lexer_token_cache_close(stg_lexer_token_cache *cache);
 
 const char *stg_lexer_token_type_as_cstr(stg_lexer_token_type token_type);
 
+// Both ignore `_` separators and stop at the literal suffix
+stg_bool_t stg_lexer_parse_integer(stg_string_view literal, stg_size_t *value);
+stg_bool_t stg_lexer_parse_float(stg_string_view literal, double *value);
+
 #endif // STG_LEXER_INCLUDED
 
 #ifdef STG_LEXER_IMPLEMENTATION
@@ -130,20 +311,169 @@ stg_bool_t stg_lexer__isalnum(char c) {
     return STG_TOBOOL((('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z') || ('0' <= c && c <= '9')));
 }
 
+enum {
+    STG_LEXER__CLASS_OTHER = 0,
+    STG_LEXER__CLASS_END,
+    STG_LEXER__CLASS_WHITESPACE,
+    STG_LEXER__CLASS_IDENTIFIER,
+    STG_LEXER__CLASS_DIGIT,
+    STG_LEXER__CLASS_QUOTE,
+    STG_LEXER__CLASS_OPERATOR,
+    STG_LEXER__CLASS_UNICODE,
+};
+
+#define STG_LEXER__FLAG_IDENTIFIER 0x1
+#define STG_LEXER__FLAG_COMMENT_START 0x2
+
+// Numbers look up to 3 chars past their end to reject things like `1e+x` and identifiers
+// decode the code point after them, which is up to 4 bytes
+#define STG_LEXER__MIN_LOOKAHEAD 4
+
+const stg_lexer_config *stg_lexer_default_config(void)
+{
+    static const char *operators[] = {
+        "+", "-", "*", "/", "%", "=", "!", "<", ">", "&", "|", "^", "~", "?", ":", ";", ",", ".", "#", "@",
+        "++", "--", "**", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "==", "!=", "<=", ">=",
+        "&&", "||", "<<", ">>", "->", "=>", "::", "..", "<<=", ">>=", "===", "!==", "...",
+    };
+    static const stg_lexer_config config = {
+        operators, sizeof(operators) / sizeof(operators[0]),
+        "//", "/*", "*/",
+        "\"'", '\\',
+        "_", STG_FALSE,
+    };
+    return &config;
+}
+
+stg_bool_t stg_lexer__copy_delimiter(char *dst, const char *src)
+{
+    stg_size_t i = 0;
+    if(src) {
+        for(; src[i] != '\0'; ++i) {
+            if(i >= STG_LEXER_MAX_DELIMITER_LENGTH) return STG_FALSE;
+            dst[i] = src[i];
+        }
+    }
+    dst[i] = '\0';
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer__table_add_operator(stg_lexer_table *table, const char *op, stg_lexer_token_type token_type)
+{
+    stg_size_t node = 0;
+    stg_size_t length = 0;
+    for(; op[length] != '\0'; ++length) {
+        unsigned char c = (unsigned char)op[length];
+        if(table->operator_char[c] == 0) {
+            if(table->operator_chars_count >= STG_LEXER_MAX_OPERATOR_CHARS) return STG_FALSE;
+            table->operator_char[c] = (unsigned char)++table->operator_chars_count;
+        }
+        unsigned char *next = &table->operator_next[node][table->operator_char[c] - 1];
+        if(*next == 0) {
+            if(table->operator_nodes_count >= STG_LEXER_MAX_OPERATOR_NODES) return STG_FALSE;
+            *next = (unsigned char)table->operator_nodes_count++;
+        }
+        node = *next;
+    }
+    if(node == 0) return STG_FALSE;
+
+    table->operator_accept[node] = (unsigned char)token_type;
+    if(table->char_class[(unsigned char)op[0]] == STG_LEXER__CLASS_OTHER) {
+        table->char_class[(unsigned char)op[0]] = STG_LEXER__CLASS_OPERATOR;
+    }
+    if(length > table->lookahead) table->lookahead = length;
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer__table_init(stg_lexer_table *table, const stg_lexer_config *config)
+{
+    static const struct { const char *op; stg_lexer_token_type token_type; } brackets[] = {
+        { "(", STG_LEXER_TOKEN_LPAREN }, { ")", STG_LEXER_TOKEN_RPAREN },
+        { "{", STG_LEXER_TOKEN_LCURLY }, { "}", STG_LEXER_TOKEN_RCURLY },
+        { "[", STG_LEXER_TOKEN_LBRACKET }, { "]", STG_LEXER_TOKEN_RBRACKET },
+    };
+
+    unsigned char *bytes = (unsigned char *)table;
+    for(stg_size_t i = 0; i < sizeof(*table); ++i) bytes[i] = 0;
+    table->operator_nodes_count = 1;
+    table->lookahead = STG_LEXER__MIN_LOOKAHEAD;
+
+    table->char_class['\0'] = STG_LEXER__CLASS_END;
+    table->char_class[' '] = table->char_class['\t'] = STG_LEXER__CLASS_WHITESPACE;
+    table->char_class['\r'] = table->char_class['\n'] = STG_LEXER__CLASS_WHITESPACE;
+    for(int c = 0; c < 256; ++c) {
+        if(stg_lexer__isalpha((char)c)) {
+            table->char_class[c] = STG_LEXER__CLASS_IDENTIFIER;
+            table->char_flags[c] |= STG_LEXER__FLAG_IDENTIFIER;
+        } else if(stg_lexer__isdigit((char)c)) {
+            table->char_class[c] = STG_LEXER__CLASS_DIGIT;
+            table->char_flags[c] |= STG_LEXER__FLAG_IDENTIFIER;
+        } else if(c >= 0x80) {
+            table->char_class[c] = STG_LEXER__CLASS_UNICODE;
+        }
+    }
+    for(const char *c = config->identifier_chars; c && *c; ++c) {
+        table->char_class[(unsigned char)*c] = STG_LEXER__CLASS_IDENTIFIER;
+        table->char_flags[(unsigned char)*c] |= STG_LEXER__FLAG_IDENTIFIER;
+    }
+    for(const char *c = config->string_quotes; c && *c; ++c) {
+        table->char_class[(unsigned char)*c] = STG_LEXER__CLASS_QUOTE;
+    }
+
+    for(stg_size_t i = 0; i < sizeof(brackets) / sizeof(brackets[0]); ++i) {
+        if(!stg_lexer__table_add_operator(table, brackets[i].op, brackets[i].token_type)) return STG_FALSE;
+    }
+    for(stg_size_t i = 0; i < config->operators_count; ++i) {
+        if(!stg_lexer__table_add_operator(table, config->operators[i], STG_LEXER_TOKEN_SYMBOL)) return STG_FALSE;
+    }
+
+    if(!stg_lexer__copy_delimiter(table->line_comment, config->line_comment)) return STG_FALSE;
+    if(!stg_lexer__copy_delimiter(table->block_comment_start, config->block_comment_start)) return STG_FALSE;
+    if(!stg_lexer__copy_delimiter(table->block_comment_end, config->block_comment_end)) return STG_FALSE;
+    if(table->block_comment_start[0] != '\0' && table->block_comment_end[0] == '\0') return STG_FALSE;
+    // Completing or breaking a delimiter changes how the chars before the edit are lexed
+    const char *delimiters[] = { table->line_comment, table->block_comment_start, table->block_comment_end };
+    for(stg_size_t i = 0; i < sizeof(delimiters) / sizeof(delimiters[0]); ++i) {
+        stg_size_t length = 0;
+        while(delimiters[i][length] != '\0') length += 1;
+        if(length > table->lookahead) table->lookahead = length;
+    }
+    table->char_flags[(unsigned char)table->line_comment[0]] |= STG_LEXER__FLAG_COMMENT_START;
+    table->char_flags[(unsigned char)table->block_comment_start[0]] |= STG_LEXER__FLAG_COMMENT_START;
+    table->char_flags['\0'] &= ~STG_LEXER__FLAG_COMMENT_START;
+    table->string_escape = config->string_escape;
+    table->validate_utf8 = STG_TOBOOL(!config->allow_invalid_utf8);
+    return STG_TRUE;
+}
+
 stg_bool_t stg_lexer_init(stg_lexer *lexer, const char *source)
 {
+    return stg_lexer_init_with_config(lexer, source, STG_NULL);
+}
+
+stg_bool_t stg_lexer_init_with_config(stg_lexer *lexer, const char *source, const stg_lexer_config *config)
+{
+    STG_PROFILE_FUNCTION();
     if(!lexer) return STG_FALSE;
     if(!source) return STG_FALSE;
+    if(!config) config = stg_lexer_default_config();
+    if(!stg_lexer__table_init(&lexer->table, config)) return STG_FALSE;
 
-    lexer->cache.head = 0;
+    lexer->cache.data = STG_NULL;
+    lexer->cache.capacity = 0;
+    lexer->cache.base = 0;
     lexer->cache.tail = 0;
-    lexer->cache.carry = STG_FALSE;
+    lexer->cache.head = 0;
+    lexer->cache.marks = 0;
     lexer->source.data = source;
     lexer->source.count = stg_lexer__strlen(source);
+    if(lexer->table.validate_utf8 && !stg_utf8_validate(source, lexer->source.count, STG_NULL)) return STG_FALSE;
     lexer->i = 0;
     lexer->cc = lexer->source.data[lexer->i];
     lexer->location.col = 1;
     lexer->location.row = 1;
+    lexer->token_start = 0;
+    lexer->token_location = lexer->location;
 
     return STG_TRUE;
 }
@@ -152,60 +482,80 @@ stg_bool_t stg_lexer_init_from_file(stg_lexer *lexer, const char *file_path)
 {
     char *source = stg_lexer_load_file_text(file_path);
     if(!source) return STG_FALSE;
-    return stg_lexer_init(lexer, source);
+    if(!stg_lexer_init(lexer, source)) {
+        stg_lexer_unload_file_text(source);
+        return STG_FALSE;
+    }
+    return STG_TRUE;
+}
+
+void stg_lexer_free_lookahead(stg_lexer *lexer)
+{
+    stg_lexer_free_memory(lexer->cache.data);
+    lexer->cache.data = STG_NULL;
+    lexer->cache.capacity = 0;
+    lexer->cache.base = lexer->cache.tail;
+    lexer->cache.head = lexer->cache.tail;
+    lexer->cache.marks = 0;
 }
 
 void stg_lexer_deinit(stg_lexer lexer)
 {
+    stg_lexer_free_lookahead(&lexer);
     stg_lexer_unload_file_text((char *)lexer.source.data);
 }
 
 stg_size_t stg_lexer__cache_count(stg_lexer *lex)
 {
-    if(lex->cache.carry) {
-        return STG_LEXER_TOKENS_CACHE_CAPACITY + lex->cache.head - lex->cache.tail;
-    } else {
-        return lex->cache.head - lex->cache.tail;
-    }
+    return lex->cache.head - lex->cache.tail;
 }
 
 stg_bool_t stg_lexer__cache_get(stg_lexer *lex, stg_size_t i, stg_lexer_token *result)
 {
-    if(stg_lexer__cache_count(lex) < 1) {
+    if(i >= stg_lexer__cache_count(lex)) {
         return STG_FALSE;
     }
 
-    *result = lex->cache.data[lex->cache.tail + i % STG_LEXER_TOKENS_CACHE_CAPACITY];
+    *result = lex->cache.data[(lex->cache.tail + i) & (lex->cache.capacity - 1)];
     return STG_TRUE;
 }
 
-stg_bool_t stg_lexer__cache_push(stg_lexer *lex, stg_lexer_token token)
+stg_bool_t stg_lexer__cache_grow(stg_lexer *lex)
 {
-    lex->cache.data[lex->cache.head] = token;
-    lex->cache.head = lex->cache.head + 1;
-    if(lex->cache.head >= STG_LEXER_TOKENS_CACHE_CAPACITY) {
-        lex->cache.head = 0;
-        lex->cache.carry = STG_TRUE;
+    stg_size_t new_capacity = lex->cache.capacity * 2;
+    if(new_capacity == 0) new_capacity = STG_LEXER_TOKENS_CACHE_CAPACITY;
+
+    stg_lexer_token *new_data = stg_lexer_alloc_memory(new_capacity * sizeof(*new_data));
+    if(!new_data) return STG_FALSE;
+    for(stg_size_t i = lex->cache.base; i < lex->cache.head; ++i) {
+        new_data[i & (new_capacity - 1)] = lex->cache.data[i & (lex->cache.capacity - 1)];
     }
+    stg_lexer_free_memory(lex->cache.data);
+    lex->cache.data = new_data;
+    lex->cache.capacity = new_capacity;
+    return STG_TRUE;
+}
 
-    if(lex->cache.head == lex->cache.tail) {
-        return STG_FALSE; // Maximum capacity exceeded
+stg_bool_t stg_lexer__cache_push(stg_lexer *lex, stg_lexer_token token)
+{
+    if(lex->cache.head - lex->cache.base >= lex->cache.capacity) {
+        if(!stg_lexer__cache_grow(lex)) return STG_FALSE;
     }
 
+    lex->cache.data[lex->cache.head & (lex->cache.capacity - 1)] = token;
+    lex->cache.head += 1;
     return STG_TRUE;
 }
 
 stg_bool_t stg_lexer__cache_shift(stg_lexer *lex, stg_lexer_token *token) 
 {
-    *token = lex->cache.data[lex->cache.tail];
-    lex->cache.tail = lex->cache.tail + 1;
-    if(lex->cache.tail >= STG_LEXER_TOKENS_CACHE_CAPACITY) {
-        if(!lex->cache.carry) {
-            return STG_FALSE; // This is when the count is 0
-        }
-        lex->cache.tail = 0;
-        lex->cache.carry = STG_FALSE;
+    if(stg_lexer__cache_count(lex) < 1) {
+        return STG_FALSE;
     }
+
+    *token = lex->cache.data[lex->cache.tail & (lex->cache.capacity - 1)];
+    lex->cache.tail += 1;
+    if(lex->cache.marks == 0) lex->cache.base = lex->cache.tail;
     return STG_TRUE;
 }
 
@@ -213,111 +563,503 @@ stg_bool_t stg_lexer__advance(stg_lexer *lex)
 {
     if(lex->i >= lex->source.count) return STG_FALSE;
     lex->i += 1;
-    lex->cc = lex->source.data[lex->i];
-    lex->location.col += 1;
+    lex->cc = lex->i < lex->source.count ? lex->source.data[lex->i] : '\0';
+    if((lex->cc & 0xC0) != 0x80) lex->location.col += 1;
     return STG_TRUE;
 }
 
-stg_bool_t stg_lexer__cache_token(stg_lexer *lex, stg_lexer_token_type token_type, stg_string_view literal)
+stg_lexer_token stg_lexer__make_token(stg_lexer *lex, stg_lexer_token_type token_type, stg_string_view literal)
 {
     stg_lexer_token token = {0};
     token.type = token_type;
     token.literal = literal;
-    token.location.col = lex->location.col - literal.count;
-    token.location.row = lex->location.row;
+    token.location = lex->token_location;
+    token.offset = lex->token_start;
+    token.length = lex->i - lex->token_start;
+    return token;
+}
+
+stg_bool_t stg_lexer__cache_token(stg_lexer *lex, stg_lexer_token_type token_type, stg_string_view literal)
+{
+    return stg_lexer__cache_push(lex, stg_lexer__make_token(lex, token_type, literal));
+}
+
+stg_bool_t stg_lexer__cache_number(stg_lexer *lex, stg_lexer_token_type token_type, stg_string_view literal)
+{
+    stg_lexer_token token = stg_lexer__make_token(lex, token_type, literal);
+#ifndef STG_LEXER_WITHOUT_NUMBER_VALUES
+    if(token_type == STG_LEXER_TOKEN_INTEGER) {
+        token.has_value = stg_lexer_parse_integer(literal, &token.value.integer);
+    } else {
+        token.has_value = stg_lexer_parse_float(literal, &token.value.floating);
+    }
+#endif // STG_LEXER_WITHOUT_NUMBER_VALUES
     return stg_lexer__cache_push(lex, token);
 }
 
-stg_bool_t stg_lexer__cache_next_token(stg_lexer *lex)
+char stg_lexer__peek_char(stg_lexer *lex, stg_size_t offset)
 {
-    if(lex->i + 1 >= lex->source.count) return STG_FALSE;
-    while(stg_lexer__iswhitespace(lex->cc)) {
-        if(lex->cc == '\n') {
-            lex->location.row += 1;
-            lex->location.col = 0;
-        }
+    if(lex->i + offset >= lex->source.count) return '\0';
+    return lex->source.data[lex->i + offset];
+}
+
+// Consumes a number literal with its suffix and returns whether it is an integer or a float
+stg_lexer_token_type stg_lexer__scan_number(stg_lexer *lex)
+{
+    stg_lexer_token_type token_type = STG_LEXER_TOKEN_INTEGER;
+    char prefix = stg_lexer__peek_char(lex, 1) | 0x20;
+    if(lex->cc == '0' && (prefix == 'x' || prefix == 'b' || prefix == 'o')) {
         stg_lexer__advance(lex);
+        stg_lexer__advance(lex);
+    } else {
+        while(stg_lexer__isdigit(lex->cc) || lex->cc == '_') stg_lexer__advance(lex);
+
+        // `1.` is a float but `1..2` and `1.foo` are not
+        char next = stg_lexer__peek_char(lex, 1);
+        if(lex->cc == '.' && (stg_lexer__isdigit(next) || (!stg_lexer__isalpha(next) && next != '_' && next != '.'))) {
+            token_type = STG_LEXER_TOKEN_FLOAT;
+            stg_lexer__advance(lex);
+            while(stg_lexer__isdigit(lex->cc) || lex->cc == '_') stg_lexer__advance(lex);
+        }
+
+        if((lex->cc | 0x20) == 'e') {
+            stg_size_t skip = (stg_lexer__peek_char(lex, 1) == '+' || stg_lexer__peek_char(lex, 1) == '-') ? 2 : 1;
+            if(stg_lexer__isdigit(stg_lexer__peek_char(lex, skip))) {
+                token_type = STG_LEXER_TOKEN_FLOAT;
+                for(stg_size_t i = 0; i < skip; ++i) stg_lexer__advance(lex);
+                while(stg_lexer__isdigit(lex->cc) || lex->cc == '_') stg_lexer__advance(lex);
+            }
+        }
     }
 
-    switch(lex->cc) {
-        case '(':
-            {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_LPAREN, stg_sv_slice(lex->source, lex->i, lex->i + 1));
-                stg_lexer__advance(lex);
-            } break;
-        case ')':
-            {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_RPAREN, stg_sv_slice(lex->source, lex->i, lex->i + 1));
+    // Digits of prefixed numbers and the suffix of every number
+    while(stg_lexer__isalnum(lex->cc) || lex->cc == '_') stg_lexer__advance(lex);
+    return token_type;
+}
+
+// XID_Start and XID_Continue of Unicode 14.0.0 up to U+32400, the only ones above it are
+// the U+E0100..U+E01EF variation selectors. Bit (c & 0xFF) of stg_lexer__xid_blocks[index[c >> 8]]
+// tells whether c has the property, the 256 code point blocks are shared between both.
+#define STG_LEXER__XID_LIMIT 0x32400
+static const unsigned char stg_lexer__xid_start_index[STG_LEXER__XID_LIMIT >> 8] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 2, 18, 19, 20, 2, 21, 22,
+    23, 24, 25, 26, 27, 28, 2, 29, 30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0,
+    34, 35, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 28, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 37, 38,
+    39, 40, 41, 42, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 43,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 2, 56,
+    57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 76, 77, 78, 79,
+    2, 2, 2, 80, 81, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 2, 2, 2, 2, 84, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 86, 87, 0, 0, 88, 89, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 90, 2, 2, 2, 2, 91, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    2, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 101,
+    0, 102, 103, 0, 0, 0, 0, 104, 105, 106, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 108, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 109,
+    110, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 113, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 114, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const unsigned char stg_lexer__xid_continue_index[STG_LEXER__XID_LIMIT >> 8] = {
+    115, 2, 3, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 2, 18, 130, 20, 2, 21, 131,
+    132, 133, 134, 135, 136, 2, 2, 29, 137, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 139, 0, 0,
+    140, 35, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 28, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 141, 38,
+    142, 143, 144, 145, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 43,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 44, 146, 46, 47, 147, 148, 50, 149, 150, 151, 152, 55, 2, 56,
+    57, 58, 153, 60, 61, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 0, 168, 169, 170, 79,
+    2, 2, 2, 80, 81, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 2, 2, 2, 2, 84, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 171, 172, 0, 0, 88, 173, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 90, 2, 2, 2, 2, 91, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    2, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 175, 0, 176, 177, 0, 97, 98, 99, 178, 0, 0, 179, 0, 0, 0, 0, 101,
+    180, 181, 182, 0, 0, 0, 0, 104, 183, 184, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 185, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 108, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 109,
+    110, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 113, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 114, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const unsigned char stg_lexer__xid_blocks[186][32] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x04, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0x03, 0x00, 0x1f, 0x50, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xb8, 0x40, 0xd7, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x87, 0x07, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x60, 0xc0, 0x00, 0x9c },
+    { 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x02, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x30, 0x04 },
+    { 0xff, 0xff, 0x3f, 0x04, 0x10, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x07, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x01, 0xff, 0x03, 0x00, 0xfe, 0xff, 0xe1, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xc5, 0x23, 0x00, 0x40, 0x00, 0xb0, 0x03, 0x00, 0x03, 0x10 },
+    { 0xe0, 0x87, 0xf9, 0xff, 0xff, 0xfd, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x1c, 0x00, 0xe0, 0xbf, 0xfb, 0xff, 0xff, 0xfd, 0xed, 0x23, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x02 },
+    { 0xe0, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xed, 0x23, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x02, 0x00, 0xe8, 0xc7, 0x3d, 0xd6, 0x18, 0xc7, 0xff, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xe0, 0xdf, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0x23, 0x00, 0x00, 0x00, 0x27, 0x03, 0x00, 0x00, 0x00, 0xe1, 0xdf, 0xfd, 0xff, 0xff, 0xfd, 0xef, 0x23, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x06, 0x00 },
+    { 0xf0, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x27, 0x00, 0x40, 0x70, 0x80, 0x03, 0x00, 0x00, 0xfc, 0xe0, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0xfb, 0x2f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xf7, 0xff, 0xff, 0xaf, 0xff, 0x05, 0x20, 0x5f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00 },
+    { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x80, 0x00, 0x00, 0x3f, 0x3c, 0x62, 0xc0, 0xe1, 0xff, 0x03, 0x40, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x7f, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x7f, 0x3d, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f },
+    { 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x01 },
+    { 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xdf, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00 },
+    { 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0xc0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x6f, 0x04 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xaa, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5f, 0xdc, 0x1f, 0xcf, 0x0f, 0xff, 0x1f, 0xdc, 0x1f },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x84, 0xfc, 0x2f, 0x3f, 0x50, 0xfd, 0xff, 0xf3, 0xe0, 0x43, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x78, 0x0c, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xbf, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 },
+    { 0xe0, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x3e, 0x1f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7 },
+    { 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f },
+    { 0xff, 0x1f, 0xff, 0xff, 0x00, 0x0c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },
+    { 0x00, 0x00, 0x80, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xeb, 0x03, 0x00, 0x00, 0xfc, 0xff },
+    { 0xbb, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x68 },
+    { 0x00, 0xfc, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x80, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x7c },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0xf7, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x7f, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x3e, 0x05, 0x00, 0x00, 0x38, 0xff, 0x07, 0x1c, 0x00 },
+    { 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00 },
+    { 0x7f, 0x00, 0xf8, 0xa0, 0xff, 0xfd, 0x7f, 0x5f, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f },
+    { 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xfc, 0xfc, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xef, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xb7, 0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xf7, 0xff, 0xf7, 0xb7, 0xff, 0xfb, 0xff, 0xfb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x3f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x91, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x37, 0x00 },
+    { 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x01, 0x00, 0xef, 0xfe, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x1f, 0x80, 0x00, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00 },
+    { 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00 },
+    { 0xf8, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x90, 0x00, 0xff, 0xff, 0xff, 0xff, 0x47, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xfb, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbd, 0xff, 0xbf, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00 },
+    { 0xe0, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xed, 0x23, 0x00, 0x00, 0x01, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x07, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x80 },
+    { 0x7f, 0xf2, 0x6f, 0xff, 0xff, 0xff, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+    { 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x07, 0x04, 0x00, 0x00, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x20, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 },
+    { 0xff, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x6f },
+    { 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x1f, 0xff, 0x01, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x64, 0xde, 0xff, 0xeb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xbf, 0xe7, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0x7b, 0x5f, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7 },
+    { 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x80, 0x3f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x6f, 0xff, 0x7f },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xef, 0xff, 0xff, 0xff, 0x96, 0xfe, 0xf7, 0x0a, 0x84, 0xea, 0x96, 0xaa, 0x96, 0xf7, 0xf7, 0x5e, 0xff, 0xfb, 0xff, 0x0f, 0xee, 0xfb, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa0, 0x04, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xb8, 0xc0, 0xd7, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb6, 0x00, 0xff, 0xff, 0xff, 0x87, 0x07, 0x00 },
+    { 0x00, 0x00, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xfd, 0xff, 0x9f },
+    { 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x24 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x07, 0xff, 0xff, 0xff, 0x7e, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xfe, 0xff, 0xef, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xc5, 0xf3, 0x9f, 0x79, 0x80, 0xb0, 0xcf, 0xff, 0x03, 0x50 },
+    { 0xee, 0x87, 0xf9, 0xff, 0xff, 0xfd, 0x6d, 0xd3, 0x87, 0x39, 0x02, 0x5e, 0xc0, 0xff, 0x3f, 0x00, 0xee, 0xbf, 0xfb, 0xff, 0xff, 0xfd, 0xed, 0xf3, 0xbf, 0x3b, 0x01, 0x00, 0xcf, 0xff, 0x00, 0xfe },
+    { 0xee, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xed, 0xf3, 0x9f, 0x39, 0xe0, 0xb0, 0xcf, 0xff, 0x02, 0x00, 0xec, 0xc7, 0x3d, 0xd6, 0x18, 0xc7, 0xff, 0xc3, 0xc7, 0x3d, 0x81, 0x00, 0xc0, 0xff, 0x00, 0x00 },
+    { 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xf3, 0xdf, 0x3d, 0x60, 0x27, 0xcf, 0xff, 0x00, 0x00, 0xef, 0xdf, 0xfd, 0xff, 0xff, 0xfd, 0xef, 0xf3, 0xdf, 0x3d, 0x60, 0x60, 0xcf, 0xff, 0x06, 0x00 },
+    { 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7d, 0xf0, 0x80, 0xcf, 0xff, 0x00, 0xfc, 0xee, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0xfb, 0x2f, 0x7f, 0x84, 0x5f, 0xff, 0xc0, 0xff, 0x0c, 0x00 },
+    { 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x7f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xf7, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x3f, 0x5f, 0x3f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00 },
+    { 0x01, 0x00, 0x00, 0x03, 0xff, 0x03, 0xa0, 0xc2, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7 },
+    { 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xfe, 0x03, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f },
+    { 0xff, 0xff, 0x3f, 0x80, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xdf, 0x0d, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x30, 0xff, 0x03, 0x00, 0x00 },
+    { 0x00, 0xb8, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00 },
+    { 0xff, 0xff, 0xff, 0x7f, 0xff, 0x0f, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x03, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x03, 0xff, 0x03, 0x80, 0x00, 0xff, 0xbf, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x03, 0x00, 0xf8, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x07 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0xe2, 0xff, 0x01, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xf8, 0x0f, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xbf, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0xff, 0xff, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff },
+    { 0xe0, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x3e, 0x1f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7 },
+    { 0xff, 0x1f, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xff, 0x03, 0xff, 0xff, 0xff, 0xe8 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0xff, 0x03, 0xff, 0xff, 0xff, 0x7f },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0x3f, 0xff, 0x03, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x38, 0xff, 0xff, 0x7c, 0x00 },
+    { 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0x03 },
+    { 0x7f, 0x00, 0xf8, 0xe0, 0xff, 0xfd, 0x7f, 0x5f, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x18, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f },
+    { 0x00, 0x00, 0xff, 0x03, 0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfc, 0xfc, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f },
+    { 0x6f, 0xf0, 0xef, 0xfe, 0xff, 0xff, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0x1f, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x3f, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x04, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x03 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xde, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbd, 0xff, 0xbf, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x03 },
+    { 0xef, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xed, 0xfb, 0x9f, 0x39, 0x81, 0xe0, 0xcf, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xc3, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xe7, 0xff, 0x0f, 0xff, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x80 },
+    { 0x7f, 0xf2, 0x6f, 0xff, 0xff, 0xff, 0xbf, 0xf9, 0x0f, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1b, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 },
+    { 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x01, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xb4, 0xff, 0x00, 0xff, 0x03, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xfb, 0x01, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x03, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x0f, 0x00, 0xff, 0x03, 0xf8, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x1f, 0xff, 0x01, 0xff, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe3, 0x07, 0xf8, 0xe7, 0x0f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x20, 0x00, 0x10, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x7f, 0xff, 0xff, 0xf9, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03 },
+};
+
+stg_bool_t stg_lexer__is_xid_start(unsigned int codepoint)
+{
+    if(codepoint >= STG_LEXER__XID_LIMIT) return STG_FALSE;
+    const unsigned char *block = stg_lexer__xid_blocks[stg_lexer__xid_start_index[codepoint >> 8]];
+    return STG_TOBOOL(block[(codepoint & 0xFF) >> 3] & (1 << (codepoint & 7)));
+}
+
+stg_bool_t stg_lexer__is_xid_continue(unsigned int codepoint)
+{
+    if(codepoint >= STG_LEXER__XID_LIMIT) return STG_TOBOOL(0xE0100 <= codepoint && codepoint <= 0xE01EF);
+    const unsigned char *block = stg_lexer__xid_blocks[stg_lexer__xid_continue_index[codepoint >> 8]];
+    return STG_TOBOOL(block[(codepoint & 0xFF) >> 3] & (1 << (codepoint & 7)));
+}
+
+// Length of the code point at the current position, 0 when malformed
+stg_size_t stg_lexer__decode(stg_lexer *lex, unsigned int *codepoint)
+{
+    return stg_utf8_decode(lex->source.data + lex->i, lex->source.count - lex->i, codepoint);
+}
+
+void stg_lexer__scan_identifier(stg_lexer *lex)
+{
+    const stg_lexer_table *table = &lex->table;
+    while(1) {
+        while(table->char_flags[(unsigned char)lex->cc] & STG_LEXER__FLAG_IDENTIFIER) stg_lexer__advance(lex);
+        if(table->char_class[(unsigned char)lex->cc] != STG_LEXER__CLASS_UNICODE) return;
+
+        unsigned int codepoint;
+        stg_size_t length = stg_lexer__decode(lex, &codepoint);
+        if(length == 0 || !stg_lexer__is_xid_continue(codepoint)) return;
+        for(stg_size_t i = 0; i < length; ++i) stg_lexer__advance(lex);
+    }
+}
+
+stg_bool_t stg_lexer__starts_with(stg_lexer *lex, const char *prefix)
+{
+    for(stg_size_t i = 0; prefix[i] != '\0'; ++i) {
+        if(stg_lexer__peek_char(lex, i) != prefix[i]) return STG_FALSE;
+    }
+    return STG_TRUE;
+}
+
+void stg_lexer__skip(stg_lexer *lex, stg_size_t count)
+{
+    for(stg_size_t i = 0; i < count; ++i) stg_lexer__advance(lex);
+}
+
+stg_bool_t stg_lexer__at_end(stg_lexer *lex)
+{
+    return STG_TOBOOL(lex->i + 1 >= lex->source.count);
+}
+
+void stg_lexer__skip_whitespace_and_comments(stg_lexer *lex)
+{
+    const stg_lexer_table *table = &lex->table;
+    while(1) {
+        unsigned char c = (unsigned char)lex->cc;
+        if(table->char_class[c] == STG_LEXER__CLASS_WHITESPACE) {
+            if(c == '\n') {
+                lex->location.row += 1;
+                lex->location.col = 0;
+            }
+            stg_lexer__advance(lex);
+        } else if(!(table->char_flags[c] & STG_LEXER__FLAG_COMMENT_START)) {
+            return;
+        } else if(table->line_comment[0] != '\0' && stg_lexer__starts_with(lex, table->line_comment)) {
+            while(lex->cc != '\n' && !stg_lexer__at_end(lex)) stg_lexer__advance(lex);
+        } else if(table->block_comment_start[0] != '\0' && stg_lexer__starts_with(lex, table->block_comment_start)) {
+            stg_lexer__skip(lex, stg_lexer__strlen(table->block_comment_start) - 1);
+            while(!stg_lexer__at_end(lex) && !stg_lexer__starts_with(lex, table->block_comment_end)) {
+                if(lex->cc == '\n') {
+                    lex->location.row += 1;
+                    lex->location.col = 0;
+                }
                 stg_lexer__advance(lex);
-            } break;
-        case '[':
+            }
+            if(!stg_lexer__at_end(lex)) stg_lexer__skip(lex, stg_lexer__strlen(table->block_comment_end) - 1);
+        } else {
+            return;
+        }
+    }
+}
+
+// Returns STG_FALSE when nothing more could be lexed or the token could not be buffered
+stg_bool_t stg_lexer__cache_next_token(stg_lexer *lex)
+{
+    if(stg_lexer__at_end(lex)) return STG_FALSE;
+    stg_size_t head = lex->cache.head;
+    stg_lexer__skip_whitespace_and_comments(lex);
+    if(stg_lexer__at_end(lex)) return STG_FALSE;
+
+    const stg_lexer_table *table = &lex->table;
+    stg_size_t start = lex->i;
+    lex->token_start = lex->i;
+    lex->token_location = lex->location;
+    switch(table->char_class[(unsigned char)lex->cc]) {
+        case STG_LEXER__CLASS_IDENTIFIER:
             {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_LBRACKET, stg_sv_slice(lex->source, lex->i, lex->i + 1));
-                stg_lexer__advance(lex);
+                stg_lexer__scan_identifier(lex);
+                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_IDENTIFIER, stg_sv_slice(lex->source, start, lex->i));
             } break;
-        case ']':
+        case STG_LEXER__CLASS_UNICODE:
             {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_RBRACKET, stg_sv_slice(lex->source, lex->i, lex->i + 1));
-                stg_lexer__advance(lex);
+                unsigned int codepoint;
+                stg_size_t length = stg_lexer__decode(lex, &codepoint);
+                if(length > 0 && stg_lexer__is_xid_start(codepoint)) {
+                    stg_lexer__scan_identifier(lex);
+                    stg_lexer__cache_token(lex, STG_LEXER_TOKEN_IDENTIFIER, stg_sv_slice(lex->source, start, lex->i));
+                } else {
+                    stg_lexer__skip(lex, length > 0 ? length : 1);
+                    stg_lexer__cache_token(lex, STG_LEXER_TOKEN_SYMBOL, stg_sv_slice(lex->source, start, lex->i));
+                }
             } break;
-        case '{':
+        case STG_LEXER__CLASS_DIGIT:
             {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_LCURLY, stg_sv_slice(lex->source, lex->i, lex->i + 1));
-                stg_lexer__advance(lex);
+                stg_lexer_token_type token_type = stg_lexer__scan_number(lex);
+                stg_lexer__cache_number(lex, token_type, stg_sv_slice(lex->source, start, lex->i));
             } break;
-        case '}':
+        case STG_LEXER__CLASS_QUOTE:
             {
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_RCURLY, stg_sv_slice(lex->source, lex->i, lex->i + 1));
+                char quote = lex->cc;
                 stg_lexer__advance(lex);
+                stg_size_t literal_start = lex->i;
+                while(lex->cc != quote && !stg_lexer__at_end(lex)) {
+                    if(lex->cc == table->string_escape && table->string_escape != '\0') stg_lexer__advance(lex);
+                    if(!stg_lexer__at_end(lex)) stg_lexer__advance(lex);
+                }
+                stg_string_view result = stg_sv_slice(lex->source, literal_start, lex->i);
+                if(!stg_lexer__at_end(lex)) stg_lexer__advance(lex);
+                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_STRING, result);
             } break;
-        case '"':
+        case STG_LEXER__CLASS_OPERATOR:
             {
-                stg_lexer__advance(lex);
-                stg_size_t start = lex->i;
-                while(lex->cc != '"') {
-                    stg_lexer__advance(lex);
+                // Walk the trie as far as it goes and keep the last operator seen on the way
+                stg_size_t node = 0, length = 0, match_length = 0;
+                stg_lexer_token_type match_type = STG_LEXER_TOKEN_SYMBOL;
+                while(1) {
+                    unsigned char symbol = table->operator_char[(unsigned char)stg_lexer__peek_char(lex, length)];
+                    if(symbol == 0) break;
+                    node = table->operator_next[node][symbol - 1];
+                    if(node == 0) break;
+                    length += 1;
+                    if(table->operator_accept[node] != 0) {
+                        match_type = (stg_lexer_token_type)table->operator_accept[node];
+                        match_length = length;
+                    }
                 }
-                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_STRING, stg_sv_slice(lex->source, start, lex->i));
-                stg_lexer__advance(lex);
+                stg_lexer__skip(lex, match_length > 0 ? match_length : 1);
+                stg_lexer__cache_token(lex, match_type, stg_sv_slice(lex->source, start, lex->i));
             } break;
         default:
             {
-                if(stg_lexer__isalpha(lex->cc) == STG_TRUE) {
-                    stg_size_t start = lex->i;
-                    while(lex->i < lex->source.count && (stg_lexer__isalnum(lex->cc) == STG_TRUE || lex->cc == '_')) {
-                        stg_lexer__advance(lex);
-                    }
-                    stg_string_view result = stg_sv_slice(lex->source, start, lex->i);
-                    stg_lexer__cache_token(lex, STG_LEXER_TOKEN_IDENTIFIER, result);
-                } else if(stg_lexer__isdigit(lex->cc) == STG_TRUE) {
-                    stg_size_t start = lex->i;
-                    stg_bool_t is_float = STG_FALSE;
-                    while(lex->i < lex->source.count && (stg_lexer__isdigit(lex->cc) == STG_TRUE || lex->cc == '.')) {
-                        if(lex->cc == '.') {
-                            if(is_float == STG_TRUE) {
-                                return STG_FALSE;
-                            }
-                            is_float = STG_TRUE;
-                        }
-                        stg_lexer__advance(lex);
-                    }
-                    stg_lexer__cache_token(lex, is_float == STG_TRUE ? STG_LEXER_TOKEN_FLOAT: STG_LEXER_TOKEN_INTEGER, 
-                            stg_sv_slice(lex->source, start, lex->i));
-                } else {
-                    stg_size_t start = lex->i;
-                    while(lex->i < lex->source.count 
-                            && stg_lexer__isalnum(lex->cc) != STG_TRUE 
-                            && stg_lexer__iswhitespace(lex->cc) != STG_TRUE
-                            && lex->cc != '"') {
-                        stg_lexer__advance(lex);
-                    }
-                    stg_string_view result = stg_sv_slice(lex->source, start, lex->i);
-                    stg_lexer__cache_token(lex, STG_LEXER_TOKEN_SYMBOL, result);
-                }
+                stg_lexer__advance(lex);
+                stg_lexer__cache_token(lex, STG_LEXER_TOKEN_SYMBOL, stg_sv_slice(lex->source, start, lex->i));
             } break;
     }
 
-    return STG_TRUE;
+    return STG_TOBOOL(lex->cache.head != head);
 }
 
 stg_bool_t stg_lexer_peek(stg_lexer *lexer, stg_lexer_token *token, stg_size_t index)
@@ -342,6 +1084,199 @@ stg_bool_t stg_lexer_next(stg_lexer *lexer, stg_lexer_token *token)
     return stg_lexer__cache_shift(lexer, token);
 }
 
+stg_lexer_mark_t stg_lexer_mark(stg_lexer *lexer)
+{
+    if(lexer->cache.marks == 0) lexer->cache.base = lexer->cache.tail;
+    lexer->cache.marks += 1;
+    return lexer->cache.tail;
+}
+
+void stg_lexer_reset(stg_lexer *lexer, stg_lexer_mark_t mark)
+{
+    if(lexer->cache.marks == 0 || mark < lexer->cache.base || mark > lexer->cache.head) return;
+    lexer->cache.tail = mark;
+}
+
+void stg_lexer_release(stg_lexer *lexer, stg_lexer_mark_t mark)
+{
+    (void)mark;
+    if(lexer->cache.marks == 0) return;
+    lexer->cache.marks -= 1;
+    if(lexer->cache.marks == 0) lexer->cache.base = lexer->cache.tail;
+}
+
+stg_bool_t stg_lexer__tokens_reserve(stg_lexer_tokens *tokens, stg_size_t count)
+{
+    if(count <= tokens->capacity) return STG_TRUE;
+
+    stg_size_t new_capacity = tokens->capacity * 2;
+    if(new_capacity < STG_LEXER_TOKENS_CACHE_CAPACITY) new_capacity = STG_LEXER_TOKENS_CACHE_CAPACITY;
+    while(new_capacity < count) new_capacity *= 2;
+
+    stg_lexer_token *new_data = stg_lexer_alloc_memory(new_capacity * sizeof(*new_data));
+    if(!new_data) return STG_FALSE;
+    for(stg_size_t i = 0; i < tokens->count; ++i) {
+        new_data[i] = tokens->data[i];
+    }
+    stg_lexer_free_memory(tokens->data);
+    tokens->data = new_data;
+    tokens->capacity = new_capacity;
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer_tokens_init(stg_lexer_tokens *tokens, const char *source)
+{
+    return stg_lexer_tokens_init_with_config(tokens, source, STG_NULL);
+}
+
+stg_bool_t stg_lexer_tokens_init_with_config(stg_lexer_tokens *tokens, const char *source, const stg_lexer_config *config)
+{
+    STG_PROFILE_FUNCTION();
+    if(!tokens) return STG_FALSE;
+    tokens->data = STG_NULL;
+    tokens->count = 0;
+    tokens->capacity = 0;
+    tokens->config = config;
+
+    stg_lexer lexer;
+    if(!stg_lexer_init_with_config(&lexer, source, config)) return STG_FALSE;
+    tokens->source = lexer.source;
+
+    stg_lexer_token token;
+    while(stg_lexer_next(&lexer, &token)) {
+        if(!stg_lexer__tokens_reserve(tokens, tokens->count + 1)) {
+            stg_lexer_free_lookahead(&lexer);
+            return STG_FALSE;
+        }
+        tokens->data[tokens->count++] = token;
+    }
+    stg_lexer_free_lookahead(&lexer);
+    return STG_TRUE;
+}
+
+void stg_lexer_tokens_deinit(stg_lexer_tokens *tokens)
+{
+    stg_lexer_free_memory(tokens->data);
+    tokens->data = STG_NULL;
+    tokens->count = 0;
+    tokens->capacity = 0;
+}
+
+stg_bool_t stg_lexer_tokens_relex(stg_lexer_tokens *tokens, const char *new_source, stg_lexer_edit edit)
+{
+    STG_PROFILE_FUNCTION();
+    if(!tokens || !new_source) return STG_FALSE;
+    if(edit.offset + edit.removed_count > tokens->source.count) return STG_FALSE;
+
+    stg_lexer lexer;
+    if(!stg_lexer_init_with_config(&lexer, "", tokens->config)) return STG_FALSE;
+    stg_size_t new_source_count = tokens->source.count - edit.removed_count + edit.inserted_count;
+
+    // The rest of the source was already valid, so only the code points touched by the edit
+    // are checked, from the last boundary before it to the first one after the inserted text
+    if(lexer.table.validate_utf8) {
+        stg_size_t begin = edit.offset >= 3 ? edit.offset - 3 : 0;
+        stg_size_t end = edit.offset + edit.inserted_count;
+        while(begin < edit.offset && (new_source[begin] & 0xC0) == 0x80) begin += 1;
+        while(end < new_source_count && (new_source[end] & 0xC0) == 0x80) end += 1;
+        if(!stg_utf8_validate(new_source + begin, end - begin, STG_NULL)) return STG_FALSE;
+    }
+
+    // A token is only decided by its own characters and the `lookahead` ones after it, so
+    // every token for which those are all before the edit is untouched. Lexing restarts at
+    // the start of the last such token, where the lexer state is known from the token itself,
+    // or at the start of the source if there is none.
+    stg_size_t lo = 0, hi = tokens->count;
+    while(lo < hi) {
+        stg_size_t mid = lo + (hi - lo) / 2;
+        if(tokens->data[mid].offset + tokens->data[mid].length + lexer.table.lookahead <= edit.offset) lo = mid + 1;
+        else hi = mid;
+    }
+    stg_size_t restart = lo > 0 ? lo - 1 : 0;
+
+    lexer.source.data = new_source;
+    lexer.source.count = new_source_count;
+    if(lo > 0) {
+        lexer.i = tokens->data[restart].offset;
+        lexer.location = tokens->data[restart].location;
+    }
+    lexer.cc = lexer.source.data[lexer.i];
+
+    // Old tokens starting after the removed range are candidates for the unchanged suffix
+    stg_size_t old_end = edit.offset + edit.removed_count;
+    stg_size_t new_end = edit.offset + edit.inserted_count;
+    stg_size_t suffix = restart;
+    while(suffix < tokens->count && tokens->data[suffix].offset < old_end) suffix += 1;
+
+    stg_lexer_tokens relexed = {0};
+    relexed.config = tokens->config;
+    stg_bool_t synced = STG_FALSE;
+    stg_lexer_token token;
+    while(stg_lexer_next(&lexer, &token)) {
+        if(token.offset >= new_end) {
+            while(suffix < tokens->count && tokens->data[suffix].offset - old_end + new_end < token.offset) suffix += 1;
+            if(suffix < tokens->count && tokens->data[suffix].offset - old_end + new_end == token.offset) {
+                synced = STG_TRUE;
+                break;
+            }
+        }
+        if(!stg_lexer__tokens_reserve(&relexed, relexed.count + 1)) {
+            stg_lexer_free_lookahead(&lexer);
+            stg_lexer_tokens_deinit(&relexed);
+            return STG_FALSE;
+        }
+        relexed.data[relexed.count++] = token;
+    }
+    stg_lexer_free_lookahead(&lexer);
+    if(!synced) suffix = tokens->count;
+
+    stg_size_t suffix_count = tokens->count - suffix;
+    stg_size_t new_count = restart + relexed.count + suffix_count;
+    if(!stg_lexer__tokens_reserve(tokens, new_count)) {
+        stg_lexer_tokens_deinit(&relexed);
+        return STG_FALSE;
+    }
+
+    // Shift the unchanged suffix. Columns only move for the tokens sharing a line with
+    // the first one, since the lexer resets the column on every new line.
+    if(suffix_count > 0) {
+        stg_lexer_token_location old_location = tokens->data[suffix].location;
+        stg_lexer_token_location new_location = token.location;
+        const char *old_source = tokens->source.data;
+        if(restart + relexed.count > suffix) {
+            for(stg_size_t i = suffix_count; i-- > 0;) 
+                tokens->data[restart + relexed.count + i] = tokens->data[suffix + i];
+        } else {
+            for(stg_size_t i = 0; i < suffix_count; ++i) 
+                tokens->data[restart + relexed.count + i] = tokens->data[suffix + i];
+        }
+        for(stg_size_t i = restart + relexed.count; i < new_count; ++i) {
+            stg_lexer_token *shifted = &tokens->data[i];
+            stg_size_t literal_offset = shifted->literal.data - (old_source + shifted->offset);
+            shifted->offset = shifted->offset - old_end + new_end;
+            shifted->literal.data = new_source + shifted->offset + literal_offset;
+            if(shifted->location.row == old_location.row) 
+                shifted->location.col = shifted->location.col - old_location.col + new_location.col;
+            shifted->location.row = shifted->location.row - old_location.row + new_location.row;
+        }
+    }
+
+    for(stg_size_t i = 0; i < relexed.count; ++i) {
+        tokens->data[restart + i] = relexed.data[i];
+    }
+    stg_lexer_tokens_deinit(&relexed);
+
+    if(new_source != tokens->source.data) {
+        for(stg_size_t i = 0; i < restart; ++i) {
+            tokens->data[i].literal.data = new_source + (tokens->data[i].literal.data - tokens->source.data);
+        }
+    }
+    tokens->count = new_count;
+    tokens->source.data = new_source;
+    tokens->source.count = lexer.source.count;
+    return STG_TRUE;
+}
+
 const char *stg_lexer_token_type_as_cstr(stg_lexer_token_type token_type) {
     const char *stg_lexer_token_types_as_cstr[] = {
         "STG_LEXER_INVALID_TOKEN",
@@ -360,6 +1295,828 @@ const char *stg_lexer_token_type_as_cstr(stg_lexer_token_type token_type) {
     return stg_lexer_token_types_as_cstr[token_type];
 }
 
+int stg_lexer__digit_value(char c)
+{
+    if('0' <= c && c <= '9') return c - '0';
+    if('a' <= (c | 0x20) && (c | 0x20) <= 'z') return (c | 0x20) - 'a' + 10;
+    return 36;
+}
+
+// Whether the 8 bytes loaded little endian into `chunk` are all ASCII digits
+stg_bool_t stg_lexer__is_eight_digits(stg_size_t chunk)
+{
+    return STG_TOBOOL((((chunk & 0xf0f0f0f0f0f0f0f0ULL) 
+                    | (((chunk + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) 
+                == 0x3333333333333333ULL));
+}
+
+// SWAR conversion of 8 ASCII digits, first digit in the lowest byte
+stg_size_t stg_lexer__parse_eight_digits(stg_size_t chunk)
+{
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32)))
+            + (((chunk >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >> 32;
+    return chunk & 0xffffffffULL;
+}
+
+stg_size_t stg_lexer__load_eight_bytes(const char *data)
+{
+    stg_size_t chunk = 0;
+    for(stg_size_t i = 0; i < 8; ++i) chunk |= (stg_size_t)(unsigned char)data[i] << (i * 8);
+    return chunk;
+}
+
+stg_bool_t stg_lexer_parse_integer(stg_string_view literal, stg_size_t *value)
+{
+    if(!value || literal.count == 0) return STG_FALSE;
+
+    stg_size_t base = 10;
+    stg_size_t i = 0;
+    if(literal.count >= 2 && literal.data[0] == '0') {
+        char prefix = literal.data[1] | 0x20;
+        if(prefix == 'x') base = 16;
+        else if(prefix == 'b') base = 2;
+        else if(prefix == 'o') base = 8;
+        if(base != 10) i = 2;
+    }
+
+    const stg_size_t max = ~0ULL;
+    stg_size_t result = 0;
+    stg_size_t digits = 0;
+    while(i < literal.count) {
+        if(base == 10 && i + 8 <= literal.count) {
+            stg_size_t chunk = stg_lexer__load_eight_bytes(literal.data + i);
+            if(stg_lexer__is_eight_digits(chunk)) {
+                chunk = stg_lexer__parse_eight_digits(chunk);
+                if(result > (max - chunk) / 100000000ULL) return STG_FALSE;
+                result = result * 100000000ULL + chunk;
+                digits += 8;
+                i += 8;
+                continue;
+            }
+        }
+
+        char c = literal.data[i];
+        if(c == '_') {
+            i += 1;
+            continue;
+        }
+        stg_size_t digit = stg_lexer__digit_value(c);
+        if(digit >= base) break;
+        if(result > (max - digit) / base) return STG_FALSE;
+        result = result * base + digit;
+        digits += 1;
+        i += 1;
+    }
+
+    // A digit or a dot right after the number means it was not an integer in this base
+    if(digits == 0) return STG_FALSE;
+    if(i < literal.count && (stg_lexer__isdigit(literal.data[i]) || literal.data[i] == '.')) return STG_FALSE;
+    *value = result;
+    return STG_TRUE;
+}
+
+// 5^q for q in [STG_LEXER__SMALLEST_POWER_OF_TEN, STG_LEXER__LARGEST_POWER_OF_TEN] as 128 bit
+// { high, low } words, shifted so the top bit is set and truncated (rounded up for q < 0)
+#define STG_LEXER__SMALLEST_POWER_OF_TEN -342
+#define STG_LEXER__LARGEST_POWER_OF_TEN 308
+static const stg_size_t stg_lexer__powers_of_five[STG_LEXER__LARGEST_POWER_OF_TEN - STG_LEXER__SMALLEST_POWER_OF_TEN + 1][2] = {
+    { 0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL }, { 0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL },
+    { 0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL }, { 0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL },
+    { 0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL }, { 0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL },
+    { 0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL }, { 0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL },
+    { 0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL }, { 0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL },
+    { 0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL }, { 0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL },
+    { 0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL }, { 0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL },
+    { 0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL }, { 0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL },
+    { 0x84a57695fe98746dULL, 0x014bb630f7604b57ULL }, { 0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL },
+    { 0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL }, { 0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL },
+    { 0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL }, { 0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL },
+    { 0xfd00b897478238d0ULL, 0x8920b098955522b4ULL }, { 0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL },
+    { 0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL }, { 0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL },
+    { 0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL }, { 0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL },
+    { 0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL }, { 0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL },
+    { 0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL }, { 0xeba09271e88d976bULL, 0xf7864a44c633682eULL },
+    { 0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL }, { 0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL },
+    { 0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL }, { 0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL },
+    { 0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL }, { 0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL },
+    { 0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL }, { 0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL },
+    { 0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL }, { 0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL },
+    { 0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL }, { 0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL },
+    { 0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL }, { 0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL },
+    { 0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL }, { 0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL },
+    { 0xa37fce126597973cULL, 0xe50ff107bab528a0ULL }, { 0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL },
+    { 0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL }, { 0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL },
+    { 0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL }, { 0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL },
+    { 0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL }, { 0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL },
+    { 0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL }, { 0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL },
+    { 0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL }, { 0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL },
+    { 0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL }, { 0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL },
+    { 0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL }, { 0x91376c36d99995beULL, 0x23100809b9c21fa1ULL },
+    { 0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL }, { 0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL },
+    { 0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL }, { 0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL },
+    { 0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL }, { 0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL },
+    { 0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL }, { 0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL },
+    { 0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL }, { 0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL },
+    { 0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL }, { 0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL },
+    { 0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL }, { 0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL },
+    { 0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL }, { 0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL },
+    { 0xc987434744ac874eULL, 0xa327ffb266b56220ULL }, { 0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL },
+    { 0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL }, { 0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL },
+    { 0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL }, { 0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL },
+    { 0xc0314325637a1939ULL, 0xfa911155fefb5308ULL }, { 0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL },
+    { 0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL }, { 0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL },
+    { 0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL }, { 0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL },
+    { 0xb749faed14125d36ULL, 0xcef980ec671f667bULL }, { 0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL },
+    { 0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL }, { 0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL },
+    { 0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL }, { 0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL },
+    { 0xaecc49914078536dULL, 0x58fae9f773886e18ULL }, { 0xda7f5bf590966848ULL, 0xaf39a475506a899eULL },
+    { 0x888f99797a5e012dULL, 0x6d8406c952429603ULL }, { 0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL },
+    { 0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL }, { 0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL },
+    { 0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL }, { 0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL },
+    { 0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL }, { 0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL },
+    { 0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL }, { 0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL },
+    { 0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL }, { 0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL },
+    { 0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL }, { 0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL },
+    { 0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL }, { 0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL },
+    { 0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL }, { 0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL },
+    { 0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL }, { 0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL },
+    { 0xb913179899f68584ULL, 0x28e2557b59846e3fULL }, { 0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL },
+    { 0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL }, { 0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL },
+    { 0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL }, { 0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL },
+    { 0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL }, { 0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL },
+    { 0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL }, { 0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL },
+    { 0xd77485cb25823ac7ULL, 0x7d633293366b828bULL }, { 0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL },
+    { 0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL }, { 0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL },
+    { 0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL }, { 0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL },
+    { 0xcd795be870516656ULL, 0x67902e276c921f8bULL }, { 0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL },
+    { 0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL }, { 0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL },
+    { 0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL }, { 0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL },
+    { 0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL }, { 0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL },
+    { 0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL }, { 0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL },
+    { 0xef340a98172aace4ULL, 0x86fb897116c87c34ULL }, { 0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL },
+    { 0xbae0a846d2195712ULL, 0x8974836059cca109ULL }, { 0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL },
+    { 0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL }, { 0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL },
+    { 0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL }, { 0x8e938662882af53eULL, 0x547eb47b7282ee9cULL },
+    { 0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL }, { 0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL },
+    { 0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL }, { 0xae0b158b4738705eULL, 0x9624ab50b148d445ULL },
+    { 0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL }, { 0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL },
+    { 0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL }, { 0xd47487cc8470652bULL, 0x7647c3200069671fULL },
+    { 0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL }, { 0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL },
+    { 0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL }, { 0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL },
+    { 0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL }, { 0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL },
+    { 0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL }, { 0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL },
+    { 0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL }, { 0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL },
+    { 0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL }, { 0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL },
+    { 0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL }, { 0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL },
+    { 0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL }, { 0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL },
+    { 0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL }, { 0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL },
+    { 0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL }, { 0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL },
+    { 0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL }, { 0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL },
+    { 0x8c974f7383725573ULL, 0x1e414218c73a13fbULL }, { 0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL },
+    { 0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL }, { 0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL },
+    { 0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL }, { 0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL },
+    { 0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL }, { 0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL },
+    { 0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL }, { 0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL },
+    { 0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL }, { 0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL },
+    { 0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL }, { 0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL },
+    { 0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL }, { 0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL },
+    { 0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL }, { 0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL },
+    { 0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL }, { 0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL },
+    { 0xbe89523386091465ULL, 0xf6bbb397f1135823ULL }, { 0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL },
+    { 0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL }, { 0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL },
+    { 0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL }, { 0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL },
+    { 0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL }, { 0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL },
+    { 0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL }, { 0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL },
+    { 0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL }, { 0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL },
+    { 0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL }, { 0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL },
+    { 0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL }, { 0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL },
+    { 0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL }, { 0x843610cb4bf160cbULL, 0xcedf722a585139baULL },
+    { 0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL }, { 0xce947a3da6a9273eULL, 0x733d226229feea32ULL },
+    { 0x811ccc668829b887ULL, 0x0806357d5a3f525fULL }, { 0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL },
+    { 0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL }, { 0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL },
+    { 0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL }, { 0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL },
+    { 0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL }, { 0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL },
+    { 0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL }, { 0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL },
+    { 0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL }, { 0xbbe226efb628afeaULL, 0x890489f70a55368bULL },
+    { 0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL }, { 0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL },
+    { 0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL }, { 0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL },
+    { 0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL }, { 0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL },
+    { 0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL }, { 0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL },
+    { 0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL }, { 0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL },
+    { 0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL }, { 0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL },
+    { 0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL }, { 0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL },
+    { 0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL }, { 0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL },
+    { 0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL }, { 0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL },
+    { 0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL }, { 0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL },
+    { 0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL }, { 0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL },
+    { 0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL }, { 0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL },
+    { 0xc24452da229b021bULL, 0xfbe85badce996168ULL }, { 0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL },
+    { 0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL }, { 0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL },
+    { 0xed246723473e3813ULL, 0x290123e9aab23b68ULL }, { 0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL },
+    { 0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL }, { 0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL },
+    { 0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL }, { 0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL },
+    { 0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL }, { 0x8d590723948a535fULL, 0x579c487e5a38ad0eULL },
+    { 0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL }, { 0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL },
+    { 0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL }, { 0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL },
+    { 0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL }, { 0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL },
+    { 0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL }, { 0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL },
+    { 0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL }, { 0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL },
+    { 0xcdb02555653131b6ULL, 0x3792f412cb06794dULL }, { 0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL },
+    { 0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL }, { 0xc8de047564d20a8bULL, 0xf245825a5a445275ULL },
+    { 0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL }, { 0x9ced737bb6c4183dULL, 0x55464dd69685606bULL },
+    { 0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL }, { 0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL },
+    { 0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL }, { 0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL },
+    { 0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL }, { 0x95a8637627989aadULL, 0xdde7001379a44aa8ULL },
+    { 0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL }, { 0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL },
+    { 0x9226712162ab070dULL, 0xcab3961304ca70e8ULL }, { 0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL },
+    { 0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL }, { 0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL },
+    { 0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL }, { 0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL },
+    { 0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL }, { 0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL },
+    { 0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL }, { 0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL },
+    { 0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL }, { 0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL },
+    { 0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL }, { 0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL },
+    { 0xcfb11ead453994baULL, 0x67de18eda5814af2ULL }, { 0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL },
+    { 0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL }, { 0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL },
+    { 0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL }, { 0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL },
+    { 0xc612062576589ddaULL, 0x95364afe032a819eULL }, { 0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL },
+    { 0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL }, { 0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL },
+    { 0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL }, { 0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL },
+    { 0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL }, { 0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL },
+    { 0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL }, { 0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL },
+    { 0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL }, { 0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL },
+    { 0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL }, { 0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL },
+    { 0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL }, { 0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL },
+    { 0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL }, { 0x89705f4136b4a597ULL, 0x31680a88f8953031ULL },
+    { 0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL }, { 0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL },
+    { 0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL }, { 0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL },
+    { 0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL }, { 0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL },
+    { 0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL }, { 0xccccccccccccccccULL, 0xcccccccccccccccdULL },
+    { 0x8000000000000000ULL, 0x0000000000000000ULL }, { 0xa000000000000000ULL, 0x0000000000000000ULL },
+    { 0xc800000000000000ULL, 0x0000000000000000ULL }, { 0xfa00000000000000ULL, 0x0000000000000000ULL },
+    { 0x9c40000000000000ULL, 0x0000000000000000ULL }, { 0xc350000000000000ULL, 0x0000000000000000ULL },
+    { 0xf424000000000000ULL, 0x0000000000000000ULL }, { 0x9896800000000000ULL, 0x0000000000000000ULL },
+    { 0xbebc200000000000ULL, 0x0000000000000000ULL }, { 0xee6b280000000000ULL, 0x0000000000000000ULL },
+    { 0x9502f90000000000ULL, 0x0000000000000000ULL }, { 0xba43b74000000000ULL, 0x0000000000000000ULL },
+    { 0xe8d4a51000000000ULL, 0x0000000000000000ULL }, { 0x9184e72a00000000ULL, 0x0000000000000000ULL },
+    { 0xb5e620f480000000ULL, 0x0000000000000000ULL }, { 0xe35fa931a0000000ULL, 0x0000000000000000ULL },
+    { 0x8e1bc9bf04000000ULL, 0x0000000000000000ULL }, { 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL },
+    { 0xde0b6b3a76400000ULL, 0x0000000000000000ULL }, { 0x8ac7230489e80000ULL, 0x0000000000000000ULL },
+    { 0xad78ebc5ac620000ULL, 0x0000000000000000ULL }, { 0xd8d726b7177a8000ULL, 0x0000000000000000ULL },
+    { 0x878678326eac9000ULL, 0x0000000000000000ULL }, { 0xa968163f0a57b400ULL, 0x0000000000000000ULL },
+    { 0xd3c21bcecceda100ULL, 0x0000000000000000ULL }, { 0x84595161401484a0ULL, 0x0000000000000000ULL },
+    { 0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL }, { 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL },
+    { 0x813f3978f8940984ULL, 0x4000000000000000ULL }, { 0xa18f07d736b90be5ULL, 0x5000000000000000ULL },
+    { 0xc9f2c9cd04674edeULL, 0xa400000000000000ULL }, { 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL },
+    { 0x9dc5ada82b70b59dULL, 0xf020000000000000ULL }, { 0xc5371912364ce305ULL, 0x6c28000000000000ULL },
+    { 0xf684df56c3e01bc6ULL, 0xc732000000000000ULL }, { 0x9a130b963a6c115cULL, 0x3c7f400000000000ULL },
+    { 0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL }, { 0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL },
+    { 0x96769950b50d88f4ULL, 0x1314448000000000ULL }, { 0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL },
+    { 0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL }, { 0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL },
+    { 0xb7abc627050305adULL, 0xf14a3d9e40000000ULL }, { 0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL },
+    { 0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL }, { 0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL },
+    { 0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL }, { 0x8c213d9da502de45ULL, 0x4526f422cc340000ULL },
+    { 0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL }, { 0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL },
+    { 0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL }, { 0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL },
+    { 0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL }, { 0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL },
+    { 0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL }, { 0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL },
+    { 0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL }, { 0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL },
+    { 0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL }, { 0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL },
+    { 0x9f4f2726179a2245ULL, 0x01d762422c946590ULL }, { 0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL },
+    { 0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL }, { 0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL },
+    { 0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL }, { 0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL },
+    { 0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL }, { 0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL },
+    { 0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL }, { 0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL },
+    { 0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL }, { 0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL },
+    { 0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL }, { 0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL },
+    { 0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL }, { 0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL },
+    { 0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL }, { 0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL },
+    { 0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL }, { 0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL },
+    { 0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL }, { 0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL },
+    { 0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL }, { 0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL },
+    { 0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL }, { 0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL },
+    { 0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL }, { 0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL },
+    { 0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL }, { 0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL },
+    { 0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL }, { 0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL },
+    { 0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL }, { 0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL },
+    { 0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL }, { 0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL },
+    { 0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL }, { 0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL },
+    { 0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL }, { 0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL },
+    { 0x924d692ca61be758ULL, 0x593c2626705f9c56ULL }, { 0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL },
+    { 0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL }, { 0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL },
+    { 0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL }, { 0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL },
+    { 0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL }, { 0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL },
+    { 0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL }, { 0x884134fe908658b2ULL, 0x3109058d147fdcddULL },
+    { 0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL }, { 0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL },
+    { 0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL }, { 0xa6539930bf6bff45ULL, 0x84db8346b786151cULL },
+    { 0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL }, { 0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL },
+    { 0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL }, { 0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL },
+    { 0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL }, { 0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL },
+    { 0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL }, { 0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL },
+    { 0x9ae757596946075fULL, 0x3375788de9b06958ULL }, { 0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL },
+    { 0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL }, { 0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL },
+    { 0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL }, { 0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL },
+    { 0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL }, { 0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL },
+    { 0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL }, { 0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL },
+    { 0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL }, { 0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL },
+    { 0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL }, { 0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL },
+    { 0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL }, { 0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL },
+    { 0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL }, { 0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL },
+    { 0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL }, { 0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL },
+    { 0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL }, { 0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL },
+    { 0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL }, { 0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL },
+    { 0x802221226be55a64ULL, 0xc2494954da2c9789ULL }, { 0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL },
+    { 0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL }, { 0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL },
+    { 0x9c69a97284b578d7ULL, 0xff2a760414536efbULL }, { 0xc38413cf25e2d70dULL, 0xfef5138519684abaULL },
+    { 0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL }, { 0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL },
+    { 0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL }, { 0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL },
+    { 0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL }, { 0xba756174393d88dfULL, 0x94f971119aeef9e4ULL },
+    { 0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL }, { 0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL },
+    { 0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL }, { 0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL },
+    { 0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL }, { 0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL },
+    { 0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL }, { 0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL },
+    { 0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL }, { 0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL },
+    { 0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL }, { 0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL },
+    { 0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL }, { 0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL },
+    { 0xa59bc234db398c25ULL, 0x43fab9837e699095ULL }, { 0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL },
+    { 0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL }, { 0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL },
+    { 0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL }, { 0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL },
+    { 0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL }, { 0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL },
+    { 0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL }, { 0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL },
+    { 0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL }, { 0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL },
+    { 0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL }, { 0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL },
+    { 0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL }, { 0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL },
+    { 0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL }, { 0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL },
+    { 0x8fa475791a569d10ULL, 0xf96e017d694487bcULL }, { 0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL },
+    { 0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL }, { 0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL },
+    { 0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL }, { 0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL },
+    { 0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL }, { 0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL },
+    { 0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL }, { 0x85c7056562757456ULL, 0xf6872d5667844e49ULL },
+    { 0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL }, { 0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL },
+    { 0x82a45b450226b39cULL, 0xecc0024661173473ULL }, { 0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL },
+    { 0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL }, { 0xff290242c83396ceULL, 0x7e67047175a15271ULL },
+    { 0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL }, { 0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL },
+    { 0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL }, { 0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL },
+    { 0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL }, { 0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL },
+    { 0x98165af37b2153deULL, 0xc3727a337a8b704aULL }, { 0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL },
+    { 0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL }, { 0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL },
+    { 0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL }, { 0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL },
+    { 0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL }, { 0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL },
+    { 0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL }, { 0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL },
+    { 0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL }, { 0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL },
+    { 0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL }, { 0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL },
+    { 0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL }, { 0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL },
+    { 0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL }, { 0xd31045a8341ca07cULL, 0x1ede48111209a050ULL },
+    { 0x83ea2b892091e44dULL, 0x934aed0aab460432ULL }, { 0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL },
+    { 0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL }, { 0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL },
+    { 0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL }, { 0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL },
+    { 0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL }, { 0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL },
+    { 0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL }, { 0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL },
+    { 0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL }, { 0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL },
+    { 0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL }, { 0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL },
+    { 0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL }, { 0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL },
+    { 0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL }, { 0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL },
+    { 0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL }, { 0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL },
+    { 0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL }, { 0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL },
+    { 0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL }, { 0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL },
+    { 0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL }, { 0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL },
+    { 0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL }, { 0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL },
+    { 0x8533285c936b35deULL, 0xd53a88958f87275fULL }, { 0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL },
+    { 0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL }, { 0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL },
+    { 0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL }, { 0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL },
+    { 0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL }, { 0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL },
+    { 0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL }, { 0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL },
+    { 0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL }, { 0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL },
+    { 0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL }, { 0x976e41088617ca01ULL, 0xd5be0503e085d813ULL },
+    { 0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL }, { 0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL },
+    { 0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL }, { 0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL },
+    { 0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL }, { 0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL },
+    { 0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL }, { 0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL },
+    { 0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL }, { 0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL },
+    { 0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL }, { 0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL },
+    { 0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL }, { 0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL },
+    { 0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL }, { 0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL },
+    { 0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL }, { 0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL },
+    { 0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL }, { 0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL },
+    { 0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL }, { 0xa0555e361951c366ULL, 0xd7e105bcc332621fULL },
+    { 0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL }, { 0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL },
+    { 0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL }, { 0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL },
+    { 0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL }, { 0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL },
+    { 0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL }, { 0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL },
+    { 0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL }, { 0xbaa718e68396cffdULL, 0xd30560258f54e6baULL },
+    { 0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL }, { 0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL },
+    { 0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL }, { 0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL },
+    { 0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL },
+};
+
+typedef struct stg_lexer__u128 {
+    stg_size_t high, low;
+} stg_lexer__u128;
+
+#if defined(__SIZEOF_INT128__)
+// __int128 is a GNU extension, __extension__ keeps -Wpedantic quiet about it
+__extension__ typedef unsigned __int128 stg_lexer__native_u128;
+#endif // __SIZEOF_INT128__
+
+stg_lexer__u128 stg_lexer__multiply(stg_size_t a, stg_size_t b)
+{
+    stg_lexer__u128 result;
+#if defined(__SIZEOF_INT128__)
+    stg_lexer__native_u128 product = (stg_lexer__native_u128)a * b;
+    result.high = (stg_size_t)(product >> 64);
+    result.low = (stg_size_t)product;
+#else
+    stg_size_t a_low = a & 0xffffffffULL, a_high = a >> 32;
+    stg_size_t b_low = b & 0xffffffffULL, b_high = b >> 32;
+    stg_size_t low_low = a_low * b_low;
+    stg_size_t high_low = a_high * b_low;
+    stg_size_t low_high = a_low * b_high;
+    stg_size_t middle = (low_low >> 32) + (high_low & 0xffffffffULL) + (low_high & 0xffffffffULL);
+    result.high = a_high * b_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    result.low = (middle << 32) | (low_low & 0xffffffffULL);
+#endif
+    return result;
+}
+
+stg_size_t stg_lexer__leading_zeros(stg_size_t x)
+{
+    stg_size_t count = 0;
+    for(stg_size_t bit = 1ULL << 63; !(x & bit); bit >>= 1) count += 1;
+    return count;
+}
+
+// Eisel-Lemire: the double nearest to mantissa * 10^exponent, from a 128 bit approximation of
+// the product with 5^exponent. Fails on the few inputs where that approximation cannot decide
+// the rounding and on overflow to infinity.
+stg_bool_t stg_lexer__eisel_lemire(stg_size_t mantissa, long exponent, double *value)
+{
+    union { stg_size_t bits; double floating; } result = {0};
+    if(mantissa == 0 || exponent < STG_LEXER__SMALLEST_POWER_OF_TEN) {
+        *value = 0.0;
+        return STG_TRUE;
+    }
+    if(exponent > STG_LEXER__LARGEST_POWER_OF_TEN) return STG_FALSE;
+
+    stg_size_t leading_zeros = stg_lexer__leading_zeros(mantissa);
+    mantissa <<= leading_zeros;
+    const stg_size_t *power = stg_lexer__powers_of_five[exponent - STG_LEXER__SMALLEST_POWER_OF_TEN];
+    // The top 55 bits of the product are kept: 52 explicit mantissa bits, the implicit one, a
+    // rounding bit and one more when the product is above 2^127. When the 9 bits below them
+    // are all ones, the low word of the power could still carry into them.
+    stg_lexer__u128 product = stg_lexer__multiply(mantissa, power[0]);
+    if((product.high & 0x1ff) == 0x1ff) {
+        stg_lexer__u128 correction = stg_lexer__multiply(mantissa, power[1]);
+        product.low += correction.high;
+        if(correction.high > product.low) product.high += 1;
+    }
+    if(product.low == ~0ULL && (exponent < -27 || exponent > 55)) return STG_FALSE;
+
+    stg_size_t upper_bit = product.high >> 63;
+    stg_size_t shift = upper_bit + 64 - 52 - 3;
+    stg_size_t bits = product.high >> shift;
+    // floor(log2(10^exponent)) + 63 + 1023, the binary exponent before normalization
+    long binary_exponent = (long)(((152170 + 65536) * exponent) >> 16) + 63 + (long)upper_bit - (long)leading_zeros + 1023;
+    if(binary_exponent <= 0) {
+        // Subnormal, or zero when even the rounding bit is shifted out
+        if(-binary_exponent + 1 >= 64) {
+            *value = 0.0;
+            return STG_TRUE;
+        }
+        bits >>= -binary_exponent + 1;
+        bits += bits & 1;
+        bits >>= 1;
+        // Rounding up to 2^52 sets the lowest exponent bit, giving the smallest normal double
+        result.bits = bits;
+        *value = result.floating;
+        return STG_TRUE;
+    }
+
+    // Exactly halfway between two doubles is only possible for small exponents, ties go to even
+    if(product.low <= 1 && -4 <= exponent && exponent <= 23 && (bits & 3) == 1 && (bits << shift) == product.high) {
+        bits &= ~1ULL;
+    }
+    bits += bits & 1;
+    bits >>= 1;
+    if(bits >= (2ULL << 52)) {
+        bits = 1ULL << 52;
+        binary_exponent += 1;
+    }
+    if(binary_exponent >= 0x7ff) return STG_FALSE;
+
+    result.bits = (bits & ~(1ULL << 52)) | ((stg_size_t)binary_exponent << 52);
+    *value = result.floating;
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer_parse_float(stg_string_view literal, double *value)
+{
+    static const double powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+    if(!value || literal.count == 0) return STG_FALSE;
+
+    // Up to 19 significant digits fit in the mantissa, the rest only moves the exponent
+    stg_size_t mantissa = 0;
+    stg_size_t significant = 0;
+    stg_size_t digits = 0;
+    stg_bool_t truncated = STG_FALSE;
+    stg_bool_t after_dot = STG_FALSE;
+    long exponent = 0;
+    stg_size_t i = 0;
+    for(; i < literal.count; ++i) {
+        char c = literal.data[i];
+        if(c == '_') continue;
+        if(c == '.' && !after_dot) {
+            after_dot = STG_TRUE;
+            continue;
+        }
+        if(!stg_lexer__isdigit(c)) break;
+
+        digits += 1;
+        if(mantissa == 0 && c == '0') {
+            if(after_dot) exponent -= 1;
+        } else if(significant < 19) {
+            mantissa = mantissa * 10 + (c - '0');
+            significant += 1;
+            if(after_dot) exponent -= 1;
+        } else {
+            truncated = STG_TRUE;
+            if(!after_dot) exponent += 1;
+        }
+    }
+    if(digits == 0) return STG_FALSE;
+
+    if(i < literal.count && (literal.data[i] | 0x20) == 'e') {
+        stg_size_t j = i + 1;
+        long sign = 1;
+        if(j < literal.count && (literal.data[j] == '+' || literal.data[j] == '-')) {
+            if(literal.data[j] == '-') sign = -1;
+            j += 1;
+        }
+        if(j < literal.count && stg_lexer__isdigit(literal.data[j])) {
+            long explicit_exponent = 0;
+            for(; j < literal.count && (stg_lexer__isdigit(literal.data[j]) || literal.data[j] == '_'); ++j) {
+                if(literal.data[j] == '_') continue;
+                if(explicit_exponent < 100000) explicit_exponent = explicit_exponent * 10 + (literal.data[j] - '0');
+            }
+            exponent += sign * explicit_exponent;
+            i = j;
+        }
+    }
+    if(i < literal.count && (stg_lexer__isdigit(literal.data[i]) || literal.data[i] == '.')) return STG_FALSE;
+
+    // Clinger's fast path: both operands are exact doubles so a single rounding gives the right result
+    const stg_size_t max_exact = 1ULL << 53;
+    if(mantissa == 0) {
+        *value = 0.0;
+        return STG_TRUE;
+    }
+    if(!truncated && mantissa <= max_exact) {
+        if(-22 <= exponent && exponent <= 22) {
+            *value = exponent < 0 
+                ? (double)mantissa / powers_of_ten[-exponent] 
+                : (double)mantissa * powers_of_ten[exponent];
+            return STG_TRUE;
+        }
+        if(22 < exponent && exponent <= 22 + 15) {
+            stg_size_t scaled = mantissa;
+            for(long e = 22; e < exponent && scaled <= max_exact; ++e) scaled *= 10;
+            if(scaled <= max_exact) {
+                *value = (double)scaled * 1e22;
+                return STG_TRUE;
+            }
+        }
+    }
+
+    if(!truncated) return stg_lexer__eisel_lemire(mantissa, exponent, value);
+    // The dropped digits put the exact value between mantissa and mantissa + 1 times 10^exponent,
+    // it is only known when both ends round to the same double
+    double lower, upper;
+    if(!stg_lexer__eisel_lemire(mantissa, exponent, &lower)) return STG_FALSE;
+    if(!stg_lexer__eisel_lemire(mantissa + 1, exponent, &upper)) return STG_FALSE;
+    if(lower != upper) return STG_FALSE;
+    *value = lower;
+    return STG_TRUE;
+}
+
+/**
+ * Token cache file layout, all fields in host byte order:
+ *  - stg_lexer__token_cache_header
+ *  - header.token_count * stg_lexer__token_cache_record
+ */
+#define STG_LEXER__TOKEN_CACHE_MAGIC 0x4c475453 // "STGL"
+#define STG_LEXER__TOKEN_CACHE_VERSION 4
+
+typedef struct stg_lexer__token_cache_header {
+    unsigned int magic;
+    unsigned int version;
+    stg_size_t source_hash;
+    stg_size_t source_count;
+    // Tokens depend on the lexer config as much as on the source
+    stg_size_t config_hash;
+    stg_size_t token_count;
+    // Row of the last token
+    stg_size_t row_count;
+} stg_lexer__token_cache_header;
+
+#define STG_LEXER__TOKEN_CACHE_HAS_VALUE 0x1
+
+typedef struct stg_lexer__token_cache_record {
+    // Bits of the integer or float value when flags has STG_LEXER__TOKEN_CACHE_HAS_VALUE
+    stg_size_t value;
+    unsigned int offset;
+    unsigned int length;
+    unsigned int row;
+    // In code points like the lexer counts them, it cannot be derived from the offsets alone
+    unsigned int col;
+    unsigned char type;
+    // The literal is the lexeme without its first `literal_start` and last `literal_trim` bytes
+    unsigned char literal_start;
+    unsigned char literal_trim;
+    unsigned char flags;
+    // Written as 0 so the file has no uninitialized padding
+    unsigned int reserved;
+} stg_lexer__token_cache_record;
+
+// Only has to be stable between runs on the same machine. Every 8 byte word is mixed
+// into the whole state, so a change in any byte spreads to all bits before the next word.
+stg_size_t stg_lexer__hash(stg_size_t hash, const void *data, stg_size_t count)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    for(stg_size_t i = 0; i < count; i += 8) {
+        stg_size_t word = 0;
+        for(stg_size_t j = 0; j < 8 && i + j < count; ++j) word |= (stg_size_t)bytes[i + j] << (j * 8);
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 32;
+    }
+    // Finalizer of MurmurHash3
+    hash ^= count;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+stg_size_t stg_lexer__hash_cstr(stg_size_t hash, const char *cstr)
+{
+    // The terminator is hashed too, so a missing string and consecutive strings stay distinct
+    return cstr ? stg_lexer__hash(hash, cstr, stg_lexer__strlen(cstr)) : stg_lexer__hash(hash, STG_NULL, 0);
+}
+
+stg_size_t stg_lexer__config_hash(const stg_lexer_config *config)
+{
+    stg_size_t hash = stg_lexer__hash(0xcbf29ce484222325ULL, &config->operators_count, sizeof(config->operators_count));
+    for(stg_size_t i = 0; i < config->operators_count; ++i) {
+        hash = stg_lexer__hash_cstr(hash, config->operators[i]);
+    }
+    hash = stg_lexer__hash_cstr(hash, config->line_comment);
+    hash = stg_lexer__hash_cstr(hash, config->block_comment_start);
+    hash = stg_lexer__hash_cstr(hash, config->block_comment_end);
+    hash = stg_lexer__hash_cstr(hash, config->string_quotes);
+    hash = stg_lexer__hash_cstr(hash, config->identifier_chars);
+    hash = stg_lexer__hash(hash, &config->string_escape, sizeof(config->string_escape));
+    return stg_lexer__hash(hash, &config->allow_invalid_utf8, sizeof(config->allow_invalid_utf8));
+}
+
+stg_bool_t stg_lexer_token_cache_write(const char *cache_path, const stg_lexer_tokens *tokens)
+{
+    if(!cache_path || !tokens) return STG_FALSE;
+    if(tokens->source.count > 0xffffffffULL) return STG_FALSE;
+
+    stg_size_t row_count = tokens->count > 0 ? tokens->data[tokens->count - 1].location.row : 0;
+    stg_size_t size = sizeof(stg_lexer__token_cache_header)
+        + tokens->count * sizeof(stg_lexer__token_cache_record);
+    unsigned char *data = stg_lexer_alloc_memory(size);
+    if(!data) return STG_FALSE;
+
+    stg_lexer__token_cache_header *header = (stg_lexer__token_cache_header *)data;
+    stg_lexer__token_cache_record *records = (stg_lexer__token_cache_record *)(header + 1);
+    header->magic = STG_LEXER__TOKEN_CACHE_MAGIC;
+    header->version = STG_LEXER__TOKEN_CACHE_VERSION;
+    header->source_hash = stg_lexer__hash(0, tokens->source.data, tokens->source.count - 1);
+    header->source_count = tokens->source.count;
+    header->config_hash = stg_lexer__config_hash(tokens->config ? tokens->config : stg_lexer_default_config());
+    header->token_count = tokens->count;
+    header->row_count = row_count;
+
+    for(stg_size_t i = 0; i < tokens->count; ++i) {
+        stg_lexer_token token = tokens->data[i];
+        stg_size_t literal_start = token.literal.data - (tokens->source.data + token.offset);
+        stg_size_t literal_trim = token.length - literal_start - token.literal.count;
+        if(literal_start > 0xff || literal_trim > 0xff || token.type > 0xff) {
+            stg_lexer_free_memory(data);
+            return STG_FALSE;
+        }
+        records[i].offset = (unsigned int)token.offset;
+        records[i].length = (unsigned int)token.length;
+        records[i].row = (unsigned int)token.location.row;
+        records[i].col = (unsigned int)token.location.col;
+        records[i].type = (unsigned char)token.type;
+        records[i].literal_start = (unsigned char)literal_start;
+        records[i].literal_trim = (unsigned char)literal_trim;
+#ifndef STG_LEXER_WITHOUT_NUMBER_VALUES
+        records[i].value = token.value.integer;
+        records[i].flags = token.has_value ? STG_LEXER__TOKEN_CACHE_HAS_VALUE : 0;
+#else
+        records[i].value = 0;
+        records[i].flags = 0;
+#endif // STG_LEXER_WITHOUT_NUMBER_VALUES
+        records[i].reserved = 0;
+    }
+
+    stg_bool_t result = stg_lexer_save_file_data(cache_path, data, size);
+    stg_lexer_free_memory(data);
+    return result;
+}
+
+stg_bool_t stg_lexer_token_cache_open(stg_lexer_token_cache *cache, const char *cache_path, const char *source)
+{
+    return stg_lexer_token_cache_open_with_config(cache, cache_path, source, STG_NULL);
+}
+
+// Checks that every record can be handed out without reading outside of the source
+stg_bool_t stg_lexer__token_cache_records_valid(const stg_lexer__token_cache_header *header)
+{
+    const stg_lexer__token_cache_record *records = (const stg_lexer__token_cache_record *)(header + 1);
+    stg_size_t source_length = header->source_count - 1;
+    for(stg_size_t i = 0; i < header->token_count; ++i) {
+        stg_lexer__token_cache_record record = records[i];
+        if(record.type >= STG_LEXER_COUNT_TOKENS) return STG_FALSE;
+        if(record.row < 1 || record.row > header->row_count) return STG_FALSE;
+        if(record.offset > source_length || record.length > source_length - record.offset) return STG_FALSE;
+        if((stg_size_t)record.literal_start + record.literal_trim > record.length) return STG_FALSE;
+        if(record.col < 1 || record.col > record.offset + 1) return STG_FALSE;
+    }
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer_token_cache_open_with_config(stg_lexer_token_cache *cache, const char *cache_path,
+        const char *source, const stg_lexer_config *config)
+{
+    if(!cache || !cache_path || !source) return STG_FALSE;
+    if(!config) config = stg_lexer_default_config();
+    cache->mapping = stg_lexer_map_file_data(cache_path, &cache->mapping_size);
+    if(!cache->mapping) return STG_FALSE;
+
+    const stg_lexer__token_cache_header *header = cache->mapping;
+    stg_size_t source_count = stg_lexer__strlen(source);
+    stg_size_t payload_size = cache->mapping_size - sizeof(*header);
+    // The token count is bounded by the file size first so the size computation below cannot overflow
+    stg_bool_t valid = STG_TOBOOL(cache->mapping_size >= sizeof(*header)
+            && header->magic == STG_LEXER__TOKEN_CACHE_MAGIC
+            && header->version == STG_LEXER__TOKEN_CACHE_VERSION
+            && header->source_count == source_count
+            && header->token_count <= payload_size / sizeof(stg_lexer__token_cache_record)
+            && payload_size == header->token_count * sizeof(stg_lexer__token_cache_record)
+            && header->config_hash == stg_lexer__config_hash(config)
+            && header->source_hash == stg_lexer__hash(0, source, source_count - 1)
+            && stg_lexer__token_cache_records_valid(header));
+    if(!valid) {
+        stg_lexer_unmap_file_data(cache->mapping, cache->mapping_size);
+        cache->mapping = STG_NULL;
+        return STG_FALSE;
+    }
+
+    cache->source = source;
+    cache->count = header->token_count;
+    cache->next = 0;
+    return STG_TRUE;
+}
+
+stg_bool_t stg_lexer_token_cache_next(stg_lexer_token_cache *cache, stg_lexer_token *token)
+{
+    if(!cache || !token || !cache->mapping) return STG_FALSE;
+    if(cache->next >= cache->count) return STG_FALSE;
+
+    const stg_lexer__token_cache_header *header = cache->mapping;
+    const stg_lexer__token_cache_record *records = (const stg_lexer__token_cache_record *)(header + 1);
+    stg_lexer__token_cache_record record = records[cache->next++];
+
+    token->type = (stg_lexer_token_type)record.type;
+    token->offset = record.offset;
+    token->length = record.length;
+    token->literal.data = cache->source + record.offset + record.literal_start;
+    token->literal.count = record.length - record.literal_start - record.literal_trim;
+    token->location.row = record.row;
+    token->location.col = record.col;
+#ifndef STG_LEXER_WITHOUT_NUMBER_VALUES
+    token->has_value = STG_TOBOOL(record.flags & STG_LEXER__TOKEN_CACHE_HAS_VALUE);
+    token->value.integer = record.value;
+#endif // STG_LEXER_WITHOUT_NUMBER_VALUES
+    return STG_TRUE;
+}
+
+void stg_lexer_token_cache_close(stg_lexer_token_cache *cache)
+{
+    if(!cache || !cache->mapping) return;
+    stg_lexer_unmap_file_data(cache->mapping, cache->mapping_size);
+    cache->mapping = STG_NULL;
+}
+
 #ifndef STG_INCLUDED
 stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t end)
 {
@@ -372,6 +2129,79 @@ stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t en
         .count = end - start,
     };
 }
+
+// stg.h has a vectorized version of this
+stg_bool_t stg_utf8_validate(const char *data, stg_size_t count, stg_size_t *error_offset)
+{
+    const unsigned char *s = (const unsigned char *)data;
+    stg_size_t i = 0;
+    while(i < count) {
+        // ASCII fast path, 8 bytes at a time
+        while(i + 8 <= count) {
+            stg_size_t word = 0;
+            for(stg_size_t k = 0; k < 8; ++k) word |= (stg_size_t)s[i + k] << (k * 8);
+            if(word & 0x8080808080808080ULL) break;
+            i += 8;
+        }
+        if(i >= count) break;
+        if(s[i] < 0x80) {
+            i += 1;
+            continue;
+        }
+
+        stg_size_t length = stg_utf8_decode(data + i, count - i, STG_NULL);
+        if(length == 0) {
+            if(error_offset) *error_offset = i;
+            return STG_FALSE;
+        }
+        i += length;
+    }
+    return STG_TRUE;
+}
+
+stg_size_t stg_utf8_decode(const char *data, stg_size_t count, unsigned int *codepoint)
+{
+    const unsigned char *s = (const unsigned char *)data;
+    if(count == 0) return 0;
+    if(s[0] < 0x80) {
+        if(codepoint) *codepoint = s[0];
+        return 1;
+    }
+
+    // Allowed range of the second byte, narrower after leads that could start overlong
+    // forms, surrogates or code points above U+10FFFF
+    stg_size_t length;
+    unsigned char lo = 0x80, hi = 0xBF;
+    unsigned int result;
+    if(s[0] < 0xC2) {
+        return 0;
+    } else if(s[0] < 0xE0) {
+        length = 2;
+        result = s[0] & 0x1F;
+    } else if(s[0] < 0xF0) {
+        length = 3;
+        result = s[0] & 0x0F;
+        if(s[0] == 0xE0) lo = 0xA0;
+        if(s[0] == 0xED) hi = 0x9F;
+    } else if(s[0] < 0xF5) {
+        length = 4;
+        result = s[0] & 0x07;
+        if(s[0] == 0xF0) lo = 0x90;
+        if(s[0] == 0xF4) hi = 0x8F;
+    } else {
+        return 0;
+    }
+
+    if(count < length) return 0;
+    if(s[1] < lo || s[1] > hi) return 0;
+    result = (result << 6) | (s[1] & 0x3F);
+    for(stg_size_t i = 2; i < length; ++i) {
+        if((s[i] & 0xC0) != 0x80) return 0;
+        result = (result << 6) | (s[i] & 0x3F);
+    }
+    if(codepoint) *codepoint = result;
+    return length;
+}
 #endif // STG_INCLUDED
 
 #ifndef STG_WITHOUT_STANDARD_LIBRARY
@@ -380,6 +2210,7 @@ stg_string_view stg_sv_slice(stg_string_view sv, stg_size_t start, stg_size_t en
 
 char *stg_lexer_load_file_text(const char *file_path)
 {
+    STG_PROFILE_FUNCTION();
     FILE *f = fopen(file_path, "r");
     if(!f) return NULL;
 
@@ -405,6 +2236,85 @@ void stg_lexer_unload_file_text(char *return_value_of_stg_lexer_load_file_text)
         free(return_value_of_stg_lexer_load_file_text);
 }
 
+#ifndef STG_LEXER_CUSTOM_ALLOCATOR
+void *stg_lexer_alloc_memory(stg_size_t size)
+{
+    STG_PROFILE_FUNCTION();
+    return malloc(size);
+}
+
+void stg_lexer_free_memory(void *ptr)
+{
+    STG_PROFILE_FUNCTION();
+    if(ptr) free(ptr);
+}
+#endif // STG_LEXER_CUSTOM_ALLOCATOR
+
+stg_bool_t stg_lexer_save_file_data(const char *file_path, const void *data, stg_size_t size)
+{
+    FILE *f = fopen(file_path, "wb");
+    if(!f) return STG_FALSE;
+    size_t written = fwrite(data, 1, size, f);
+    if(fclose(f) != 0) return STG_FALSE;
+    return STG_TOBOOL(written == size);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const void *stg_lexer_map_file_data(const char *file_path, stg_size_t *size)
+{
+    int fd = open(file_path, O_RDONLY);
+    if(fd < 0) return NULL;
+
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    void *result = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(result == MAP_FAILED) return NULL;
+    *size = st.st_size;
+    return result;
+}
+
+void stg_lexer_unmap_file_data(const void *return_value_of_stg_lexer_map_file_data, stg_size_t size)
+{
+    if(return_value_of_stg_lexer_map_file_data)
+        munmap((void *)return_value_of_stg_lexer_map_file_data, size);
+}
+#else
+const void *stg_lexer_map_file_data(const char *file_path, stg_size_t *size)
+{
+    FILE *f = fopen(file_path, "rb");
+    if(!f) return NULL;
+
+    fseek(f, 0L, SEEK_END);
+    size_t filesz = ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    void *result = malloc(filesz > 0 ? filesz : 1);
+    if(!result || fread(result, 1, filesz, f) != filesz) {
+        free(result);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = filesz;
+    return result;
+}
+
+void stg_lexer_unmap_file_data(const void *return_value_of_stg_lexer_map_file_data, stg_size_t size)
+{
+    (void)size;
+    if(return_value_of_stg_lexer_map_file_data)
+        free((void *)return_value_of_stg_lexer_map_file_data);
+}
+#endif
+
 #endif // STG_LEXER_WITHOUT_STANDARD_LIBRARY
 
 #endif // STG_LEXER_IMPLEMENTATION
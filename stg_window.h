@@ -33,6 +33,12 @@
     #define STG_EVENT_QUEUE_CAPACITY 512
 #endif // STG_EVENT_QUEUE_CAPACITY
 
+// Bucket i of a stats histogram counts samples in [2^i, 2^(i+1)) nanoseconds,
+// the last bucket also takes everything above it
+#ifndef STG_DEVICE_STATS_HISTOGRAM_BUCKETS
+    #define STG_DEVICE_STATS_HISTOGRAM_BUCKETS 32
+#endif // STG_DEVICE_STATS_HISTOGRAM_BUCKETS
+
 #define STG_WINDOW_BACKEND STG_WINDOW_BACKEND_X11
 #define STG_WINDOW_BACKEND_X11      0
 #define STG_WINDOW_BACKEND_WIN32    1
@@ -77,8 +83,28 @@ typedef union stg_event_as {
 typedef struct stg_event {
     stg_event_type type;
     stg_event_as as;
+    // stg_platform_get_time_ns() of when the event was received, filled by
+    // stg_push_event() if left as 0
+    stg_size_t timestamp;
 } stg_event;
 
+typedef struct stg_device_stats {
+    stg_size_t pushed_events;
+    stg_size_t shifted_events;
+    stg_size_t dropped_events;
+    stg_size_t queue_count;
+    stg_size_t queue_high_water;
+
+    stg_size_t collect_calls;
+    stg_size_t collect_total_ns;
+    stg_size_t collect_max_ns;
+    stg_size_t collect_histogram[STG_DEVICE_STATS_HISTOGRAM_BUCKETS];
+
+    // Time between an event timestamp and stg_shift_event() returning it
+    stg_size_t event_age_max_ns;
+    stg_size_t event_age_histogram[STG_DEVICE_STATS_HISTOGRAM_BUCKETS];
+} stg_device_stats;
+
 typedef struct stg_device stg_device;
 
 typedef struct stg_window stg_window;
@@ -89,10 +115,17 @@ void stg_destroy_device(stg_device *device);
 stg_window *stg_create_window(stg_device *device, int width, int height, const char *title);
 void stg_destroy_window(stg_window *window);
 
+// Translates the pending platform events into the event queue and records how long it took
+// in the collect stats
 void stg_collect_events(stg_device *device);
 stg_bool_t stg_push_event(stg_device *device, const stg_event event);
 stg_bool_t stg_shift_event(stg_device *device, stg_event *event);
 
+void stg_get_device_stats(stg_device *device, stg_device_stats *stats);
+void stg_reset_device_stats(stg_device *device);
+// Returns the upper bound in nanoseconds of the bucket holding the given percentile (0-100)
+stg_size_t stg_device_stats_percentile(const stg_size_t *histogram, stg_size_t percentile);
+
 #endif // STG_WINDOW_INCLUDED
 
 #ifdef STG_WINDOW_IMPLEMENTATION
@@ -103,6 +136,9 @@ typedef struct stg_platform_device stg_platform_device;
     #include <X11/Xlib.h>
     struct stg_platform_device {
         Display *dpy;
+        // Last geometry seen in a ConfigureNotify, which X11 sends for moves and resizes alike
+        Window configured;
+        int x, y, width, height;
     };
 
     struct stg_window {
@@ -117,35 +153,174 @@ typedef struct stg_device {
         stg_size_t head, tail;
         stg_bool_t carry;
     } event_queue;
+    stg_device_stats stats;
 } stg_device;
 
+stg_size_t stg__event_queue_count(stg_device *device)
+{
+    if(device->event_queue.carry) {
+        return STG_EVENT_QUEUE_CAPACITY + device->event_queue.head - device->event_queue.tail;
+    } else {
+        return device->event_queue.head - device->event_queue.tail;
+    }
+}
+
+void stg__stats_histogram_record(stg_size_t *histogram, stg_size_t ns)
+{
+    stg_size_t bucket = 0;
+    while(ns > 1 && bucket < STG_DEVICE_STATS_HISTOGRAM_BUCKETS - 1) {
+        ns >>= 1;
+        bucket += 1;
+    }
+    histogram[bucket] += 1;
+}
+
 stg_bool_t stg_push_event(stg_device *device, const stg_event event)
 {
-    device->event_queue.data[device->event_queue.head] = event;
+    if(device->event_queue.carry && device->event_queue.head == device->event_queue.tail) {
+        device->stats.dropped_events += 1;
+        return STG_FALSE; // Maximum capacity exceeded
+    }
+
+    stg_event *slot = &device->event_queue.data[device->event_queue.head];
+    *slot = event;
+    if(slot->timestamp == 0) slot->timestamp = stg_platform_get_time_ns();
+
     device->event_queue.head = device->event_queue.head + 1;
     if(device->event_queue.head >= STG_EVENT_QUEUE_CAPACITY) {
         device->event_queue.head = 0;
         device->event_queue.carry = STG_TRUE;
     }
 
-    if(device->event_queue.head == device->event_queue.tail) 
-        return STG_FALSE; // Maximum capacity exceeded
-
+    stg_size_t count = stg__event_queue_count(device);
+    device->stats.pushed_events += 1;
+    if(count > device->stats.queue_high_water) device->stats.queue_high_water = count;
     return STG_TRUE;
 }
 
 stg_bool_t stg_shift_event(stg_device *device, stg_event *event)
 {
+    if(!device->event_queue.carry && device->event_queue.head == device->event_queue.tail) 
+        return STG_FALSE; // This is when the count is 0
+
     *event = device->event_queue.data[device->event_queue.tail];
     device->event_queue.tail = device->event_queue.tail + 1;
     if(device->event_queue.tail >= STG_EVENT_QUEUE_CAPACITY) {
-        if(!device->event_queue.carry) {
-            return STG_FALSE; // This is when the count is 0
-        }
         device->event_queue.tail = 0;
         device->event_queue.carry = STG_FALSE;
     }
+
+    stg_size_t now = stg_platform_get_time_ns();
+    stg_size_t age = now > event->timestamp ? now - event->timestamp : 0;
+    device->stats.shifted_events += 1;
+    if(age > device->stats.event_age_max_ns) device->stats.event_age_max_ns = age;
+    stg__stats_histogram_record(device->stats.event_age_histogram, age);
+    return STG_TRUE;
+}
+
+void stg_get_device_stats(stg_device *device, stg_device_stats *stats)
+{
+    *stats = device->stats;
+    stats->queue_count = stg__event_queue_count(device);
+}
+
+void stg_reset_device_stats(stg_device *device)
+{
+    stg_memset(&device->stats, 0, sizeof(device->stats));
+    device->stats.queue_high_water = stg__event_queue_count(device);
+}
+
+stg_size_t stg_device_stats_percentile(const stg_size_t *histogram, stg_size_t percentile)
+{
+    stg_size_t total = 0;
+    for(stg_size_t i = 0; i < STG_DEVICE_STATS_HISTOGRAM_BUCKETS; ++i) 
+        total += histogram[i];
+    if(total == 0) return 0;
+
+    // Rank of the sample we are looking for, rounded up so p100 is the last sample
+    stg_size_t rank = (total * percentile + 99) / 100;
+    if(rank == 0) rank = 1;
+
+    stg_size_t seen = 0;
+    for(stg_size_t i = 0; i < STG_DEVICE_STATS_HISTOGRAM_BUCKETS; ++i) {
+        seen += histogram[i];
+        if(seen >= rank) return 1ULL << (i + 1);
+    }
+    return 1ULL << STG_DEVICE_STATS_HISTOGRAM_BUCKETS;
+}
+
+void stg__device_record_collect(stg_device *device, stg_size_t start_ns)
+{
+    stg_size_t elapsed = stg_platform_get_time_ns() - start_ns;
+    device->stats.collect_calls += 1;
+    device->stats.collect_total_ns += elapsed;
+    if(elapsed > device->stats.collect_max_ns) device->stats.collect_max_ns = elapsed;
+    stg__stats_histogram_record(device->stats.collect_histogram, elapsed);
+}
+
+#if STG_WINDOW_BACKEND == STG_WINDOW_BACKEND_X11
+stg_bool_t stg__x11_translate_configure(stg_platform_device *platform, const XConfigureEvent *xconfigure, stg_event *event)
+{
+    stg_bool_t known = STG_TOBOOL(platform->configured == xconfigure->window);
+    stg_bool_t resized = STG_TOBOOL(!known || platform->width != xconfigure->width || platform->height != xconfigure->height);
+    stg_bool_t moved = STG_TOBOOL(known && (platform->x != xconfigure->x || platform->y != xconfigure->y));
+    platform->configured = xconfigure->window;
+    platform->x = xconfigure->x;
+    platform->y = xconfigure->y;
+    platform->width = xconfigure->width;
+    platform->height = xconfigure->height;
+    if(!resized && !moved) return STG_FALSE; // Stacking or border changes only
+
+    event->type = resized ? STG_EVENT_WINDOW_RESIZED : STG_EVENT_WINDOW_MOVED;
+    event->as.window_event.x = xconfigure->x;
+    event->as.window_event.y = xconfigure->y;
+    event->as.window_event.width = xconfigure->width;
+    event->as.window_event.height = xconfigure->height;
     return STG_TRUE;
 }
 
+void stg_collect_events(stg_device *device)
+{
+    STG_PROFILE_FUNCTION();
+    stg_size_t start = stg_platform_get_time_ns();
+    while(device->platform.dpy && XPending(device->platform.dpy) > 0) {
+        XEvent xevent;
+        XNextEvent(device->platform.dpy, &xevent);
+
+        stg_event event = {0};
+        event.timestamp = stg_platform_get_time_ns();
+        switch(xevent.type) {
+            case KeyPress:
+                {
+                    event.type = STG_EVENT_KEY_PRESSED;
+                    event.as.key_event.keycode = xevent.xkey.keycode;
+                } break;
+            case KeyRelease:
+                {
+                    event.type = STG_EVENT_KEY_RELEASED;
+                    event.as.key_event.keycode = xevent.xkey.keycode;
+                } break;
+            case MotionNotify:
+                {
+                    event.type = STG_EVENT_CURSOR_MOVED;
+                    event.as.cursor_event.x = xevent.xmotion.x;
+                    event.as.cursor_event.y = xevent.xmotion.y;
+                } break;
+            case ConfigureNotify:
+                {
+                    if(!stg__x11_translate_configure(&device->platform, &xevent.xconfigure, &event)) continue;
+                } break;
+            case DestroyNotify:
+                {
+                    event.type = STG_EVENT_WINDOW_CLOSED;
+                } break;
+            default:
+                continue;
+        }
+        stg_push_event(device, event);
+    }
+    stg__device_record_collect(device, start);
+}
+#endif
+
 #endif // STG_WINDOW_IMPLEMENTATION
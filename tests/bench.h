@@ -0,0 +1,39 @@
+/**
+ * Helpers shared by the bench_*.c programs, include after "../stg.h".
+ * Every result is printed as one JSON object per line so runs can be diffed
+ * and tracked over time, e.g. `make bench > bench_output.txt`.
+ */
+#ifndef BENCH_INCLUDED
+#define BENCH_INCLUDED
+
+#include <stdio.h>
+
+#ifndef BENCH_MIN_NS
+    #define BENCH_MIN_NS 250000000ULL
+#endif // BENCH_MIN_NS
+
+// `op` names what `ops` counts (token, event, byte...), `bytes` and `allocations` may be 0
+void bench_report(const char *name, stg_size_t ns, stg_size_t bytes, const char *op, stg_size_t ops, stg_size_t allocations)
+{
+    double seconds = ns > 0 ? (double)ns / 1e9 : 1e-9;
+    printf("{\"bench\":\"%s\",\"seconds\":%.6f", name, seconds);
+    if(bytes > 0) printf(",\"bytes\":%llu,\"mb_per_s\":%.2f", bytes, (double)bytes / seconds / 1e6);
+    if(ops > 0) {
+        printf(",\"op\":\"%s\",\"ops\":%llu,\"ops_per_s\":%.0f,\"ns_per_op\":%.3f",
+                op, ops, (double)ops / seconds, (double)ns / (double)ops);
+    }
+    printf(",\"allocations\":%llu}\n", allocations);
+    fflush(stdout);
+}
+
+// xorshift64, deterministic so corpora are the same on every run
+stg_size_t bench_random(void)
+{
+    static stg_size_t state = 0x9e3779b97f4a7c15ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+#endif // BENCH_INCLUDED
@@ -0,0 +1,230 @@
+#define STG_IMPLEMENTATION
+#include "../stg.h"
+#include "bench.h"
+
+static stg_byte_t src_buffer[1 << 20];
+static stg_byte_t dst_buffer[1 << 20];
+
+void bench_memory(void)
+{
+    stg_size_t sizes[] = { 64, 4096, 1 << 20 };
+    char name[64];
+    for(stg_size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        stg_size_t size = sizes[s];
+        stg_size_t ops = 0;
+        stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            for(int i = 0; i < 64; ++i, ++ops) stg_memcpy(dst_buffer, (const char *)src_buffer, size);
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        snprintf(name, sizeof(name), "stg_memcpy/%llu", size);
+        bench_report(name, elapsed, ops * size, "call", ops, 0);
+
+        ops = 0;
+        start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            for(int i = 0; i < 64; ++i, ++ops) stg_memset(dst_buffer, (int)ops, size);
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        snprintf(name, sizeof(name), "stg_memset/%llu", size);
+        bench_report(name, elapsed, ops * size, "call", ops, 0);
+    }
+
+    stg_memset(src_buffer, 'a', sizeof(src_buffer));
+    src_buffer[sizeof(src_buffer) - 1] = '\0';
+    stg_size_t ops = 0, length = 0;
+    stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS) {
+        length += stg_strlen((const char *)src_buffer);
+        ops += 1;
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report("stg_strlen/1048576", elapsed, length, "call", ops, 0);
+}
+
+// Fills `buffer` with text where about one char in `one_in` is a 2, 3 or 4 byte code point
+void fill_utf8(stg_byte_t *buffer, stg_size_t size, stg_size_t one_in)
+{
+    static const char *code_points[] = { "\xc3\xa9", "\xce\xbb", "\xe5\xa4\x89", "\xe2\x86\x92", "\xf0\x9f\x99\x82" };
+    stg_size_t i = 0;
+    while(i + 4 < size) {
+        stg_size_t r = bench_random();
+        if(one_in > 0 && r % one_in == 0) {
+            const char *code_point = code_points[(r >> 16) % 5];
+            while(*code_point) buffer[i++] = (stg_byte_t)*code_point++;
+        } else {
+            buffer[i++] = 'a' + (r >> 8) % 26;
+        }
+    }
+    while(i < size) buffer[i++] = ' ';
+}
+
+int bench_utf8(void)
+{
+    struct { const char *name; stg_size_t one_in; } corpora[] = {
+        { "ascii", 0 }, { "mostly_ascii", 64 }, { "mixed", 4 }, { "non_ascii", 1 },
+    };
+    char name[64];
+    for(stg_size_t c = 0; c < sizeof(corpora) / sizeof(corpora[0]); ++c) {
+        fill_utf8(src_buffer, sizeof(src_buffer), corpora[c].one_in);
+        stg_size_t ops = 0, valid = 0;
+        stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            valid += stg_utf8_validate((const char *)src_buffer, sizeof(src_buffer), STG_NULL);
+            ops += 1;
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        if(valid != ops) return -1;
+        snprintf(name, sizeof(name), "stg_utf8_validate/%s/1048576", corpora[c].name);
+        bench_report(name, elapsed, ops * sizeof(src_buffer), "call", ops, 0);
+    }
+
+    // A bad byte at the very end must still be found
+    src_buffer[sizeof(src_buffer) - 1] = 0xC3;
+    stg_size_t error_offset = 0;
+    if(stg_utf8_validate((const char *)src_buffer, sizeof(src_buffer), &error_offset)) return -1;
+    if(error_offset != sizeof(src_buffer) - 1) return -1;
+    return 0;
+}
+
+void bench_dynamic_array(void)
+{
+    stg_size_t counts[] = { 1000, 1000000, 16000000 };
+    char name[64];
+    for(stg_size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        stg_size_t ops = 0, allocations = 0;
+        stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            stg_da(int) numbers = {0};
+            for(stg_size_t i = 0; i < counts[c]; ++i) {
+                stg_size_t capacity = numbers.capacity;
+                stg_da_append(&numbers, (int)i);
+                if(numbers.capacity != capacity) allocations += 1;
+            }
+            stg_da_free(&numbers);
+            ops += counts[c];
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        snprintf(name, sizeof(name), "stg_da_append/%llu", counts[c]);
+        bench_report(name, elapsed, ops * sizeof(int), "append", ops, allocations);
+    }
+
+    int chunk[64] = {0};
+    stg_size_t ops = 0, allocations = 0;
+    stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS) {
+        stg_da(int) numbers = {0};
+        for(stg_size_t i = 0; i < 1000000 / 64; ++i) {
+            stg_size_t capacity = numbers.capacity;
+            stg_da_append_many(&numbers, chunk, 64);
+            if(numbers.capacity != capacity) allocations += 1;
+        }
+        stg_da_free(&numbers);
+        ops += 1000000 / 64;
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report("stg_da_append_many/64x15625", elapsed, ops * sizeof(chunk), "append", ops, allocations);
+}
+
+/************************
+ * Job system
+ ************************/
+#define LEAF_JOBS_PER_NODE 256
+#define NODE_JOBS 256
+
+typedef struct job_tree_node {
+    stg_job_system *system;
+    stg_size_t leaves[LEAF_JOBS_PER_NODE];
+} job_tree_node;
+
+static job_tree_node job_tree[NODE_JOBS];
+
+void leaf_job(void *user_data)
+{
+    stg_size_t *leaf = user_data;
+    *leaf += 1;
+}
+
+void node_job(void *user_data)
+{
+    job_tree_node *node = user_data;
+    stg_job_counter counter = {0};
+    for(stg_size_t i = 0; i < LEAF_JOBS_PER_NODE; ++i) {
+        stg_job_run(node->system, leaf_job, &node->leaves[i], &counter);
+    }
+    stg_job_wait(node->system, &counter);
+}
+
+static stg_size_t range_values[1 << 22];
+
+void sum_range(void *user_data, stg_size_t begin, stg_size_t end)
+{
+    stg_size_t *sum = user_data;
+    stg_size_t local = 0;
+    for(stg_size_t i = begin; i < end; ++i) local += range_values[i];
+    stg_atomic_add(sum, local);
+}
+
+int bench_jobs(void)
+{
+    char name[64];
+    stg_size_t max_workers = stg_platform_processor_count();
+    for(stg_size_t i = 0; i < sizeof(range_values) / sizeof(range_values[0]); ++i) range_values[i] = i & 0xff;
+
+    for(stg_size_t workers = 1; workers <= max_workers; workers *= 2) {
+        stg_job_system *system = stg_job_system_create(workers);
+        if(!system) return -1;
+
+        // Fork-join tree of tiny jobs, the leaves are mostly stolen from the node jobs
+        stg_size_t runs = 0;
+        stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            stg_job_counter counter = {0};
+            for(stg_size_t i = 0; i < NODE_JOBS; ++i) {
+                job_tree[i].system = system;
+                stg_job_run(system, node_job, &job_tree[i], &counter);
+            }
+            stg_job_wait(system, &counter);
+            runs += 1;
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        for(stg_size_t i = 0; i < NODE_JOBS; ++i) {
+            for(stg_size_t j = 0; j < LEAF_JOBS_PER_NODE; ++j) {
+                if(job_tree[i].leaves[j] != runs) return -1;
+                job_tree[i].leaves[j] = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "stg_job_run/fork_join/%lluw", workers);
+        bench_report(name, elapsed, 0, "job", runs * NODE_JOBS * (LEAF_JOBS_PER_NODE + 1), 0);
+
+        runs = 0;
+        start = stg_platform_get_time_ns(), elapsed = 0;
+        while(elapsed < BENCH_MIN_NS) {
+            stg_size_t sum = 0;
+            stg_job_parallel_for(system, sizeof(range_values) / sizeof(range_values[0]), 4096, sum_range, &sum);
+            if(sum != (sizeof(range_values) / sizeof(range_values[0]) / 256) * (255 * 256 / 2)) return -1;
+            runs += 1;
+            elapsed = stg_platform_get_time_ns() - start;
+        }
+        snprintf(name, sizeof(name), "stg_job_parallel_for/sum/%lluw", workers);
+        bench_report(name, elapsed, runs * sizeof(range_values), "element", runs * (sizeof(range_values) / sizeof(range_values[0])), 0);
+
+        stg_job_system_destroy(system);
+    }
+    return 0;
+}
+
+int main(void)
+{
+    bench_memory();
+    if(bench_utf8() != 0) {
+        fprintf(stderr, "UTF-8 validation returned wrong results\n");
+        return -1;
+    }
+    bench_dynamic_array();
+    if(bench_jobs() != 0) {
+        fprintf(stderr, "Job system returned wrong results\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,184 @@
+#define STG_IMPLEMENTATION
+#define STG_LEXER_CUSTOM_ALLOCATOR
+#include "../stg.h"
+#include "../stg_lexer.h"
+#include "bench.h"
+#include <stdlib.h>
+
+/************************
+ * Lexer allocator, implemented here to count allocations
+ ************************/
+static stg_size_t allocations = 0;
+
+void *stg_lexer_alloc_memory(stg_size_t size)
+{
+    allocations += 1;
+    return malloc(size);
+}
+
+void stg_lexer_free_memory(void *ptr)
+{
+    free(ptr);
+}
+
+/************************
+ * Corpora
+ ************************/
+typedef enum corpus_kind {
+    CORPUS_MIXED = 0,
+    CORPUS_IDENTIFIERS,
+    CORPUS_STRINGS,
+    CORPUS_NUMBERS,
+    COUNT_CORPUS_KINDS,
+} corpus_kind;
+
+const char *corpus_names[] = { "mixed", "identifiers", "strings", "numbers" };
+
+stg_size_t append_identifier(char *dst)
+{
+    static const char *words[] = { "console", "log", "value", "index", "result", "buffer", "x", "count", "item_" };
+    stg_size_t count = 0;
+    const char *word = words[bench_random() % (sizeof(words) / sizeof(words[0]))];
+    while(*word) dst[count++] = *word++;
+    stg_size_t suffix = bench_random() % 100;
+    if(suffix < 10) dst[count++] = '0' + suffix;
+    return count;
+}
+
+stg_size_t append_string(char *dst)
+{
+    stg_size_t count = 0;
+    stg_size_t length = 4 + bench_random() % 60;
+    dst[count++] = '"';
+    for(stg_size_t i = 0; i < length; ++i) dst[count++] = 'a' + (bench_random() % 26);
+    dst[count++] = '"';
+    return count;
+}
+
+stg_size_t append_number(char *dst)
+{
+    switch(bench_random() % 4) {
+        case 0:  return snprintf(dst, 32, "%llu", bench_random() % 100000);
+        case 1:  return snprintf(dst, 32, "%llu.%llu", bench_random() % 1000, bench_random() % 1000000);
+        case 2:  return snprintf(dst, 32, "0x%llx", bench_random() & 0xffffffff);
+        default: return snprintf(dst, 32, "%llue-%llu", bench_random() % 100000000, bench_random() % 30);
+    }
+}
+
+stg_size_t append_statement(char *dst)
+{
+    stg_size_t count = 0;
+    count += append_identifier(dst + count);
+    dst[count++] = '(';
+    count += append_identifier(dst + count);
+    dst[count++] = ',';
+    dst[count++] = ' ';
+    count += append_number(dst + count);
+    dst[count++] = ',';
+    dst[count++] = ' ';
+    count += append_string(dst + count);
+    dst[count++] = ')';
+    dst[count++] = ';';
+    return count;
+}
+
+// Generated sources are made of whitespace separated items of the given kind
+char *generate_corpus(corpus_kind kind, stg_size_t size)
+{
+    char *source = malloc(size + 1);
+    if(!source) return NULL;
+
+    char item[256];
+    stg_size_t count = 0;
+    stg_size_t column = 0;
+    while(1) {
+        stg_size_t item_count = 0;
+        switch(kind) {
+            case CORPUS_MIXED:       item_count = append_statement(item); break;
+            case CORPUS_IDENTIFIERS: item_count = append_identifier(item); break;
+            case CORPUS_STRINGS:     item_count = append_string(item); break;
+            case CORPUS_NUMBERS:     item_count = append_number(item); break;
+            default: break;
+        }
+        if(count + item_count + 1 > size) break;
+        stg_memcpy(source + count, item, item_count);
+        count += item_count;
+        column += item_count;
+        source[count++] = column > 80 ? '\n' : ' ';
+        if(column > 80) column = 0;
+    }
+    source[count] = '\0';
+    return source;
+}
+
+/************************
+ * Benchmarks
+ ************************/
+void bench_lex(const char *name, const char *source, stg_size_t source_count)
+{
+    stg_size_t tokens = 0;
+    stg_size_t runs = 0;
+    allocations = 0;
+    stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS || runs == 0) {
+        stg_lexer lexer;
+        stg_lexer_token token;
+        if(!stg_lexer_init(&lexer, source)) return;
+        while(stg_lexer_next(&lexer, &token)) tokens += 1;
+        stg_lexer_free_lookahead(&lexer);
+        runs += 1;
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report(name, elapsed, runs * source_count, "token", tokens, allocations);
+}
+
+void bench_tokens_init(const char *name, const char *source, stg_size_t source_count)
+{
+    stg_size_t tokens = 0;
+    stg_size_t runs = 0;
+    allocations = 0;
+    stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS || runs == 0) {
+        stg_lexer_tokens result;
+        stg_lexer_tokens_init(&result, source);
+        tokens += result.count;
+        stg_lexer_tokens_deinit(&result);
+        runs += 1;
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report(name, elapsed, runs * source_count, "token", tokens, allocations);
+}
+
+int main(int argc, char **argv)
+{
+    // Size of the large corpus in MB, `make bench BENCH_LARGE_MB=0` skips it
+    stg_size_t large_mb = argc > 1 ? strtoull(argv[1], NULL, 10) : 256;
+    struct { const char *name; stg_size_t size; } sizes[] = {
+        { "small", 64 << 10 },
+        { "medium", 16 << 20 },
+    };
+
+    char name[128];
+    for(stg_size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        for(int kind = 0; kind < COUNT_CORPUS_KINDS; ++kind) {
+            char *source = generate_corpus(kind, sizes[s].size);
+            if(!source) return -1;
+            stg_size_t source_count = stg_lexer__strlen(source) - 1;
+
+            snprintf(name, sizeof(name), "lexer/next/%s/%s", corpus_names[kind], sizes[s].name);
+            bench_lex(name, source, source_count);
+            snprintf(name, sizeof(name), "lexer/tokens_init/%s/%s", corpus_names[kind], sizes[s].name);
+            bench_tokens_init(name, source, source_count);
+            free(source);
+        }
+    }
+
+    if(large_mb > 0) {
+        char *source = generate_corpus(CORPUS_MIXED, large_mb << 20);
+        if(!source) return -1;
+        snprintf(name, sizeof(name), "lexer/next/mixed/%lluMB", large_mb);
+        bench_lex(name, source, stg_lexer__strlen(source) - 1);
+        free(source);
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+#define STG_IMPLEMENTATION
+#define STG_PROFILE
+#include "../stg.h"
+#include "bench.h"
+#include <string.h>
+
+void profiled_leaf(void)
+{
+    STG_PROFILE_ZONE("profiled_leaf");
+}
+
+stg_size_t count_leaf_zones(const char *json)
+{
+    stg_size_t count = 0;
+    for(const char *c = json; (c = strstr(c, "\"name\":\"profiled_leaf\"")) != STG_NULL; ++c) count += 1;
+    return count;
+}
+
+int bench_profile(void)
+{
+    // Stays within the thread buffer so that every zone is exported
+    stg_size_t zones = STG_PROFILE_BUFFER_CAPACITY / 2;
+    // The first zone measures the tick rate, it is left out of the timing and the trace
+    profiled_leaf();
+    stg_profile_reset();
+    stg_size_t start = stg_platform_get_time_ns();
+    for(stg_size_t i = 0; i < zones; ++i) profiled_leaf();
+    stg_size_t elapsed = stg_platform_get_time_ns() - start;
+    bench_report("stg_profile_zone", elapsed, 0, "zone", zones, 0);
+
+    // Allocated from the platform heap because stg_malloc would record a zone between sizing and writing
+    stg_size_t size = stg_profile_export_chrome_trace(STG_NULL, 0);
+    stg_size_t capacity = size + 1;
+    char *json = stg_platform_heap_alloc(capacity);
+    if(!json) return -1;
+    start = stg_platform_get_time_ns();
+    stg_size_t written = stg_profile_export_chrome_trace(json, capacity);
+    elapsed = stg_platform_get_time_ns() - start;
+    bench_report("stg_profile_export_chrome_trace", elapsed, written, "zone", zones, 0);
+
+    int result = (written == size && json[written] == '\0' && count_leaf_zones(json) == zones &&
+            strncmp(json, "{\"traceEvents\":[", 16) == 0 && stg_profile_dropped_zones() == 0) ? 0 : -1;
+
+    // Exporting and resetting once per frame keeps recording indefinitely
+    stg_size_t frames = 4 * STG_PROFILE_BUFFER_CAPACITY / zones;
+    start = stg_platform_get_time_ns();
+    for(stg_size_t frame = 0; frame < frames; ++frame) {
+        stg_profile_reset();
+        for(stg_size_t i = 0; i < zones; ++i) profiled_leaf();
+        written = stg_profile_export_chrome_trace(json, capacity);
+    }
+    elapsed = stg_platform_get_time_ns() - start;
+    bench_report("stg_profile_reset/frames", elapsed, 0, "zone", frames * zones, 0);
+    if(written >= capacity || count_leaf_zones(json) != zones || stg_profile_dropped_zones() != 0) result = -1;
+
+    stg_platform_heap_free(json);
+    return result;
+}
+
+int main(void)
+{
+    if(bench_profile() != 0) {
+        fprintf(stderr, "Profiler exported wrong results\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+#define STG_IMPLEMENTATION
+#include "../stg_window.h"
+#include "bench.h"
+
+static stg_device device;
+
+int main(void)
+{
+    stg_event event = {0};
+    event.type = STG_EVENT_CURSOR_MOVED;
+
+    // One event in flight at a time, the common case of a mostly idle queue
+    stg_size_t ops = 0;
+    stg_size_t start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS) {
+        for(int i = 0; i < 1024; ++i, ++ops) {
+            stg_event shifted;
+            event.timestamp = 0;
+            event.as.cursor_event.x = i;
+            stg_push_event(&device, event);
+            stg_shift_event(&device, &shifted);
+        }
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report("event_queue/push_shift", elapsed, 0, "event", ops, 0);
+
+    // Fill the queue up to its capacity then drain it
+    ops = 0;
+    start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS) {
+        for(int i = 0; i < STG_EVENT_QUEUE_CAPACITY; ++i) {
+            event.timestamp = 0;
+            stg_push_event(&device, event);
+        }
+        stg_event shifted;
+        while(stg_shift_event(&device, &shifted)) ops += 1;
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report("event_queue/burst", elapsed, 0, "event", ops, 0);
+
+    // Pushing into a full queue only counts the drop
+    for(int i = 0; i < STG_EVENT_QUEUE_CAPACITY; ++i) stg_push_event(&device, event);
+    ops = 0;
+    start = stg_platform_get_time_ns(), elapsed = 0;
+    while(elapsed < BENCH_MIN_NS) {
+        for(int i = 0; i < 1024; ++i, ++ops) stg_push_event(&device, event);
+        elapsed = stg_platform_get_time_ns() - start;
+    }
+    bench_report("event_queue/dropped", elapsed, 0, "event", ops, 0);
+
+    return 0;
+}
@@ -1,7 +1,251 @@
 #define STG_IMPLEMENTATION
 #include "../stg.h"
+#include <stdio.h>
+#include <string.h>
+
+static void increment_job(void *user_data)
+{
+    stg_atomic_add((int *)user_data, 1);
+}
+
+stg_bool_t test_job_run(stg_job_system *system)
+{
+    int value = 0;
+    stg_job_counter counter = {0};
+    for(int i = 0; i < 10000; ++i) stg_job_run(system, increment_job, &value, &counter);
+    stg_job_wait(system, &counter);
+    return STG_TOBOOL(value == 10000 && counter.value == 0);
+}
+
+typedef struct fork_join_node {
+    stg_job_system *system;
+    int depth;
+    int *leaves;
+} fork_join_node;
+
+static void fork_join_job(void *user_data)
+{
+    fork_join_node *node = user_data;
+    if(node->depth == 0) {
+        stg_atomic_add(node->leaves, 1);
+        return;
+    }
+
+    // Every level waits on its children from inside a job
+    fork_join_node children[2];
+    stg_job_counter counter = {0};
+    for(int i = 0; i < 2; ++i) {
+        children[i] = *node;
+        children[i].depth = node->depth - 1;
+        stg_job_run(node->system, fork_join_job, &children[i], &counter);
+    }
+    stg_job_wait(node->system, &counter);
+}
+
+stg_bool_t test_job_fork_join(stg_job_system *system)
+{
+    int leaves = 0;
+    fork_join_node root = { system, 12, &leaves };
+    stg_job_counter counter = {0};
+    stg_job_run(system, fork_join_job, &root, &counter);
+    stg_job_wait(system, &counter);
+    return STG_TOBOOL(leaves == 1 << 12);
+}
+
+typedef struct parallel_for_data {
+    unsigned char visits[10007];
+    stg_size_t grain;
+    int bad_ranges;
+} parallel_for_data;
+
+static void visit_range(void *user_data, stg_size_t begin, stg_size_t end)
+{
+    parallel_for_data *data = user_data;
+    if(begin >= end || end - begin > data->grain) stg_atomic_add(&data->bad_ranges, 1);
+    for(stg_size_t i = begin; i < end; ++i) data->visits[i] += 1;
+}
+
+stg_bool_t test_job_parallel_for(stg_job_system *system)
+{
+    static parallel_for_data data;
+    stg_size_t count = sizeof(data.visits);
+    // Neither a multiple of the grain nor of the worker count
+    data.grain = 64;
+    stg_job_parallel_for(system, count, data.grain, visit_range, &data);
+    stg_bool_t result = STG_TOBOOL(data.bad_ranges == 0);
+    for(stg_size_t i = 0; i < count; ++i) {
+        if(data.visits[i] != 1) result = STG_FALSE;
+    }
+    return result;
+}
+
+stg_bool_t test_job_nested_system(stg_job_system *system)
+{
+    // A second system made and destroyed on this thread hands its worker back to the first
+    stg_job_system *nested = stg_job_system_create(2);
+    if(!nested) return STG_FALSE;
+    stg_bool_t result = test_job_run(nested);
+    stg_job_system_destroy(nested);
+    return STG_TOBOOL(result && test_job_run(system) && stg__current_job_worker == &system->workers[0]);
+}
+
+typedef struct utf8_sample {
+    const char *bytes;
+    stg_size_t count;
+} utf8_sample;
+
+// Bad sequences placed at every offset around the 16 and 64 byte blocks of the vectorized path
+stg_bool_t test_utf8_validate(void)
+{
+    static const utf8_sample malformed[] = {
+        { "\xc0\xaf", 2 },             // Overlong '/'
+        { "\xc1\xbf", 2 },
+        { "\xe0\x80\xaf", 3 },
+        { "\xe0\x9f\xbf", 3 },         // Overlong U+07FF
+        { "\xf0\x80\x80\xaf", 4 },
+        { "\xf0\x8f\xbf\xbf", 4 },     // Overlong U+FFFF
+        { "\xed\xa0\x80", 3 },         // U+D800
+        { "\xed\xbf\xbf", 3 },         // U+DFFF
+        { "\xf4\x90\x80\x80", 4 },     // U+110000
+        { "\xf5\x80\x80\x80", 4 },
+        { "\xff", 1 },
+        { "\x80", 1 },                 // Continuation without a lead byte
+        { "\xe2\x82", 2 },             // Truncated
+        { "\xf0\x9f\x98", 3 },
+    };
+    static const utf8_sample wellformed[] = {
+        { "\xc2\x80", 2 },             // U+0080
+        { "\xe0\xa0\x80", 3 },         // U+0800
+        { "\xed\x9f\xbf", 3 },         // U+D7FF
+        { "\xee\x80\x80", 3 },         // U+E000
+        { "\xf0\x90\x80\x80", 4 },     // U+10000
+        { "\xf4\x8f\xbf\xbf", 4 },     // U+10FFFF
+    };
+
+    char buffer[160];
+    stg_bool_t result = STG_TRUE;
+    for(stg_size_t offset = 0; offset < 140; ++offset) {
+        for(stg_size_t i = 0; i < sizeof(malformed) / sizeof(malformed[0]); ++i) {
+            // Valid multi byte text before the error, ASCII after it
+            for(stg_size_t j = 0; j < sizeof(buffer); ++j) buffer[j] = 'x';
+            for(stg_size_t j = 0; j + 2 <= offset; j += 2) stg_memcpy(buffer + j, "\xc3\xa9", 2);
+            stg_memcpy(buffer + offset, malformed[i].bytes, malformed[i].count);
+            stg_size_t count = offset + malformed[i].count + (i % 2 ? 0 : 9);
+
+            stg_size_t error_offset = 0;
+            if(stg_utf8_validate(buffer, count, &error_offset) || error_offset != offset) {
+                fprintf(stderr, "Malformed sample %llu at offset %llu reported at %llu\n", i, offset, error_offset);
+                result = STG_FALSE;
+            }
+            error_offset = 0;
+            if(stg__utf8_validate_scalar((const stg_byte_t *)buffer, 0, count, &error_offset) || error_offset != offset) {
+                result = STG_FALSE;
+            }
+            if(stg_utf8_decode(buffer + offset, count - offset, STG_NULL) != 0) result = STG_FALSE;
+        }
+        for(stg_size_t i = 0; i < sizeof(wellformed) / sizeof(wellformed[0]); ++i) {
+            for(stg_size_t j = 0; j < sizeof(buffer); ++j) buffer[j] = 'x';
+            stg_memcpy(buffer + offset, wellformed[i].bytes, wellformed[i].count);
+            if(!stg_utf8_validate(buffer, offset + wellformed[i].count, STG_NULL)) {
+                fprintf(stderr, "Well formed sample %llu at offset %llu rejected\n", i, offset);
+                result = STG_FALSE;
+            }
+            if(stg_utf8_decode(buffer + offset, wellformed[i].count, STG_NULL) != wellformed[i].count) result = STG_FALSE;
+#ifdef STG__UTF8_SSSE3
+            // Valid text must not be handed to the scalar validator, ending on the sample or on ASCII
+            for(stg_size_t count = offset + wellformed[i].count; count <= offset + wellformed[i].count + 9; count += 9) {
+                if(__builtin_cpu_supports("ssse3") && stg__utf8_error_block_ssse3((const stg_byte_t *)buffer, count) != count) {
+                    fprintf(stderr, "Well formed sample %llu at offset %llu flagged by the vector checks\n", i, offset);
+                    result = STG_FALSE;
+                }
+            }
+#endif // STG__UTF8_SSSE3
+        }
+    }
+    return result;
+}
+
+// Exports twice into a buffer of exactly the size the sizing call asked for, returns -1 unless
+// both exports fit and are the same bytes
+stg_size_t count_trace_events(void)
+{
+    stg_size_t size = stg_profile_export_chrome_trace(STG_NULL, 0);
+    stg_size_t capacity = size + 1;
+    char *json = stg_malloc(2 * capacity);
+    if(!json) return STG_CAST(stg_size_t, -1);
+    stg_size_t written = stg_profile_export_chrome_trace(json, capacity);
+    stg_size_t written_again = stg_profile_export_chrome_trace(json + capacity, capacity);
+
+    stg_size_t count = STG_CAST(stg_size_t, -1);
+    if(written == size && written_again == size && json[written] == '\0' && memcmp(json, json + capacity, capacity) == 0) {
+        count = 0;
+        for(stg_size_t i = 0; i + 4 <= written; ++i) {
+            if(memcmp(json + i, "\"ph\"", 4) == 0) count += 1;
+        }
+    }
+    stg_free(json);
+    return count;
+}
+
+stg_bool_t test_profile_reset(void)
+{
+    // Zones are recorded by hand so the test does not depend on STG_PROFILE
+    for(stg_size_t i = 0; i < STG_PROFILE_BUFFER_CAPACITY + 10; ++i) {
+        stg_profile_zone zone = { "test_zone", stg_profile_ticks(), 0 };
+        stg_profile_zone_end(&zone);
+    }
+    if(stg_profile_dropped_zones() != 10 || count_trace_events() != STG_PROFILE_BUFFER_CAPACITY) return STG_FALSE;
+
+    stg_profile_reset();
+    if(stg_profile_dropped_zones() != 0 || count_trace_events() != 0) return STG_FALSE;
+
+    // The freed slots are used again
+    for(stg_size_t i = 0; i < 5; ++i) {
+        stg_profile_zone zone = { "test_zone", stg_profile_ticks(), 0 };
+        stg_profile_zone_end(&zone);
+    }
+    return STG_TOBOOL(stg_profile_dropped_zones() == 0 && count_trace_events() == 5);
+}
 
 int main(void)
 {
     stg_tracelog(STG_LOG_INFO, "Logging is successful");
+
+    if(!test_utf8_validate()) {
+        fprintf(stderr, "UTF-8 validation test failed\n");
+        return -1;
+    }
+
+    if(!test_profile_reset()) {
+        fprintf(stderr, "Profile reset test failed\n");
+        return -1;
+    }
+
+    stg_job_system *system = stg_job_system_create(4);
+    if(!system) {
+        fprintf(stderr, "Failed to create the job system\n");
+        return -1;
+    }
+
+    if(!test_job_run(system)) {
+        fprintf(stderr, "Job run test failed\n");
+        return -1;
+    }
+
+    if(!test_job_fork_join(system)) {
+        fprintf(stderr, "Job fork-join test failed\n");
+        return -1;
+    }
+
+    if(!test_job_parallel_for(system)) {
+        fprintf(stderr, "Job parallel for test failed\n");
+        return -1;
+    }
+
+    if(!test_job_nested_system(system)) {
+        fprintf(stderr, "Nested job system test failed\n");
+        return -1;
+    }
+    stg_job_system_destroy(system);
+    return 0;
 }
@@ -1,6 +1,7 @@
 #define STG_LEXER_IMPLEMENTATION
 #include "../stg_lexer.h"
 #include <stdio.h>
+#include <string.h>
 
 void dump_token(stg_lexer_token token)
 {
@@ -10,7 +11,319 @@ void dump_token(stg_lexer_token token)
             STG_SV_ARGV(token.literal));
 }
 
+stg_bool_t test_lookahead(void)
+{
+    char source[4096] = {0};
+    stg_size_t count = 0;
+    for(int i = 0; i < 200; ++i) {
+        count += snprintf(source + count, sizeof(source) - count, "t%d ", i);
+    }
+
+    stg_lexer lexer;
+    stg_lexer_init(&lexer, source);
+    stg_lexer_token far, token;
+    if(!stg_lexer_peek(&lexer, &far, 150)) return STG_FALSE;
+
+    stg_lexer_mark_t mark = stg_lexer_mark(&lexer);
+    for(int i = 0; i <= 150; ++i) {
+        if(!stg_lexer_next(&lexer, &token)) return STG_FALSE;
+    }
+    if(token.literal.data != far.literal.data) return STG_FALSE;
+
+    stg_lexer_reset(&lexer, mark);
+    stg_lexer_release(&lexer, mark);
+    if(!stg_lexer_next(&lexer, &token)) return STG_FALSE;
+    stg_lexer_free_lookahead(&lexer);
+    return STG_TOBOOL(token.literal.count == 2 && token.literal.data[1] == '0');
+}
+
+stg_bool_t test_relex_edit(const stg_lexer_config *config, const char *old_source, stg_size_t offset, stg_size_t removed_count, const char *inserted)
+{
+    char new_source[256] = {0};
+    stg_size_t inserted_count = strlen(inserted);
+    memcpy(new_source, old_source, offset);
+    memcpy(new_source + offset, inserted, inserted_count);
+    strcpy(new_source + offset + inserted_count, old_source + offset + removed_count);
+
+    stg_lexer_tokens relexed, expected;
+    stg_lexer_edit edit = { offset, removed_count, inserted_count };
+    if(!stg_lexer_tokens_init_with_config(&relexed, old_source, config)) return STG_FALSE;
+    if(!stg_lexer_tokens_relex(&relexed, new_source, edit)) return STG_FALSE;
+    if(!stg_lexer_tokens_init_with_config(&expected, new_source, config)) return STG_FALSE;
+
+    stg_bool_t result = STG_TOBOOL(relexed.count == expected.count);
+    for(stg_size_t i = 0; result && i < expected.count; ++i) {
+        stg_lexer_token a = relexed.data[i], b = expected.data[i];
+        result = STG_TOBOOL(a.type == b.type && a.offset == b.offset && a.length == b.length
+                && a.location.row == b.location.row && a.location.col == b.location.col
+                && a.literal.data == b.literal.data && a.literal.count == b.literal.count);
+    }
+    if(!result) fprintf(stderr, "Relex mismatch on:\n%s\n", new_source);
+    stg_lexer_tokens_deinit(&relexed);
+    stg_lexer_tokens_deinit(&expected);
+    return result;
+}
+
+stg_bool_t test_relex(void)
+{
+    const char *source = "function main() {\n    console.log(\"hello world\");\n    let x = 12;\n}\n";
+    // Completing a comment opener turns tokens before the edit, further back than any
+    // operator is long, into a comment
+    static const char *operators[] = { "<", "=", ">" };
+    stg_lexer_config config = {0};
+    config.operators = operators;
+    config.operators_count = sizeof(operators) / sizeof(operators[0]);
+    config.block_comment_start = "<======";
+    config.block_comment_end = "=>";
+    config.line_comment = "#######";
+    return STG_TOBOOL(test_relex_edit(STG_NULL, source, 13, 0, "argc")
+        && test_relex_edit(STG_NULL, source, 9, 4, "start")
+        && test_relex_edit(STG_NULL, source, 18, 0, "foo();\n")
+        && test_relex_edit(STG_NULL, source, 30, 0, "\"")
+        && test_relex_edit(STG_NULL, source, 56, 2, "3.5")
+        && test_relex_edit(STG_NULL, source, 0, 9, "")
+        && test_relex_edit(STG_NULL, source, 64, 0, "  bar")
+        && test_relex_edit(&config, "a <===== b => c", 8, 0, "=")
+        && test_relex_edit(&config, "a <====== b => c", 8, 1, "")
+        && test_relex_edit(&config, "a ###### b\nc", 8, 0, "#"));
+}
+
+stg_bool_t test_token_cache(void)
+{
+    const char *cache_path = "test_stg_lexer.cache";
+    char source[] = "function main() {\n    console.log(\"hello\n world\");\n\n    let x = 12;\n}\n";
+    stg_lexer_tokens tokens;
+    if(!stg_lexer_tokens_init(&tokens, source)) return STG_FALSE;
+    if(!stg_lexer_token_cache_write(cache_path, &tokens)) return STG_FALSE;
+
+    stg_lexer_token_cache cache;
+    if(!stg_lexer_token_cache_open(&cache, cache_path, source)) return STG_FALSE;
+    stg_lexer_token token;
+    stg_size_t count = 0;
+    stg_bool_t result = STG_TRUE;
+    while(result && stg_lexer_token_cache_next(&cache, &token)) {
+        stg_lexer_token expected = tokens.data[count++];
+        result = STG_TOBOOL(token.type == expected.type && token.offset == expected.offset
+                && token.length == expected.length
+                && token.location.row == expected.location.row && token.location.col == expected.location.col
+                && token.literal.data == expected.literal.data && token.literal.count == expected.literal.count);
+    }
+    result = STG_TOBOOL(result && count == tokens.count);
+    stg_lexer_token_cache_close(&cache);
+
+    // Any change to the source invalidates the cache
+    source[0] = 'F';
+    if(stg_lexer_token_cache_open(&cache, cache_path, source)) result = STG_FALSE;
+    source[0] = 'f';
+
+    // So does lexing with another config
+    stg_lexer_config config = *stg_lexer_default_config();
+    config.string_escape = 0;
+    if(stg_lexer_token_cache_open_with_config(&cache, cache_path, source, &config)) result = STG_FALSE;
+    if(!stg_lexer_token_cache_open_with_config(&cache, cache_path, source, STG_NULL)) result = STG_FALSE;
+    stg_lexer_token_cache_close(&cache);
+
+    // Corrupted records are rejected instead of handing out tokens outside of the source
+    FILE *file = fopen(cache_path, "r+b");
+    // Row of the last record, past the last row
+    if(!file || fseek(file, -16, SEEK_END) != 0) return STG_FALSE;
+    unsigned int row = 0xffff;
+    fwrite(&row, sizeof(row), 1, file);
+    fclose(file);
+    if(stg_lexer_token_cache_open(&cache, cache_path, source)) result = STG_FALSE;
+    stg_lexer_tokens_deinit(&tokens);
+
+    // Sources that only differ in the last byte of two consecutive 8 byte words
+    const char *first = "let x0 = 1; y0 = 2;";
+    const char *second = "let x0 2 1; y0 T 2;";
+    if(!stg_lexer_tokens_init(&tokens, first)) return STG_FALSE;
+    if(!stg_lexer_token_cache_write(cache_path, &tokens)) result = STG_FALSE;
+    if(stg_lexer_token_cache_open(&cache, cache_path, second)) result = STG_FALSE;
+    stg_lexer_tokens_deinit(&tokens);
+
+    // Columns count code points on both paths
+    const char *unicode = "/* \xc3\xa9\xc3\xa9 */ abc = \xce\xbb\xce\xbb + x;";
+    if(!stg_lexer_tokens_init(&tokens, unicode)) return STG_FALSE;
+    if(!stg_lexer_token_cache_write(cache_path, &tokens)) result = STG_FALSE;
+    if(!stg_lexer_token_cache_open(&cache, cache_path, unicode)) result = STG_FALSE;
+    for(count = 0; stg_lexer_token_cache_next(&cache, &token); ++count) {
+        stg_size_t expected_cols[] = { 10, 14, 16, 19, 21, 22 };
+        if(count >= sizeof(expected_cols) / sizeof(expected_cols[0]) || token.location.col != expected_cols[count]) {
+            result = STG_FALSE;
+        }
+    }
+    result = STG_TOBOOL(result && count == tokens.count);
+    stg_lexer_token_cache_close(&cache);
+
+    stg_lexer_tokens_deinit(&tokens);
+    remove(cache_path);
+    return result;
+}
+
+stg_bool_t test_numbers(void)
+{
+    const char *source = "0x1F 0b1010 0o17 1_000_000 18446744073709551615 18446744073709551616 "
+        "3.25 1e10 2.5e-3 10u 1.5f 1..2 0.1 123456789.123456789e-5 "
+        "12345678e-25 1.7976931348623157e308 123456789012345678901.0 4.9e-324 1e400 "
+        "2.074348423759745132934254e136";
+    struct { stg_lexer_token_type type; stg_bool_t has_value; stg_size_t integer; double floating; } expected[] = {
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 0x1F, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 10, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 15, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 1000000, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 18446744073709551615ULL, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_FALSE, 0, 0 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 3.25 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 1e10 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 2.5e-3 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 10, 0 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 1.5 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 1, 0 },
+        { STG_LEXER_TOKEN_SYMBOL, STG_FALSE, 0, 0 },
+        { STG_LEXER_TOKEN_INTEGER, STG_TRUE, 2, 0 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 0.1 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 123456789.123456789e-5 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 12345678e-25 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 1.7976931348623157e308 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 123456789012345678901.0 },
+        { STG_LEXER_TOKEN_FLOAT, STG_TRUE, 0, 4.9e-324 },
+        // Does not fit
+        { STG_LEXER_TOKEN_FLOAT, STG_FALSE, 0, 0 },
+        // The digits past the 19th decide the rounding
+        { STG_LEXER_TOKEN_FLOAT, STG_FALSE, 0, 0 },
+    };
+
+    stg_lexer lexer;
+    stg_lexer_init(&lexer, source);
+    stg_lexer_token token;
+    stg_bool_t result = STG_TRUE;
+    for(stg_size_t i = 0; result && i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        result = stg_lexer_next(&lexer, &token);
+        result = STG_TOBOOL(result && token.type == expected[i].type && token.has_value == expected[i].has_value);
+        if(result && token.has_value && token.type == STG_LEXER_TOKEN_INTEGER) 
+            result = STG_TOBOOL(token.value.integer == expected[i].integer);
+        if(result && token.has_value && token.type == STG_LEXER_TOKEN_FLOAT) 
+            result = STG_TOBOOL(token.value.floating == expected[i].floating);
+        if(!result) fprintf(stderr, "Unexpected number token %llu: "STG_SV_FMT"\n", i, STG_SV_ARGV(token.literal));
+    }
+    stg_lexer_free_lookahead(&lexer);
+    return result;
+}
+
+stg_bool_t test_config(void)
+{
+    const char *source = "a<<=b->c /* x\n y */ d -- e\n'\\''; x $ y";
+    const char *expected[] = { "a", "<<=", "b", "->", "c", "d", "\\'", ";", "x", "$", "y" };
+    static const char *operators[] = { "<", "<<", "<<=", "-", "->", ";", "$" };
+    stg_lexer_config config = {0};
+    config.operators = operators;
+    config.operators_count = sizeof(operators) / sizeof(operators[0]);
+    config.line_comment = "--";
+    config.block_comment_start = "/*";
+    config.block_comment_end = "*/";
+    config.string_quotes = "'";
+    config.string_escape = '\\';
+
+    stg_lexer lexer;
+    if(!stg_lexer_init_with_config(&lexer, source, &config)) return STG_FALSE;
+    stg_lexer_token token;
+    stg_bool_t result = STG_TRUE;
+    stg_size_t count = 0;
+    while(result && stg_lexer_next(&lexer, &token)) {
+        result = STG_TOBOOL(count < sizeof(expected) / sizeof(expected[0]) &&
+                token.literal.count == strlen(expected[count]) &&
+                memcmp(token.literal.data, expected[count], token.literal.count) == 0);
+        if(result && count == 5) result = STG_TOBOOL(token.location.row == 2 && token.location.col == 7);
+        count += 1;
+    }
+    stg_lexer_free_lookahead(&lexer);
+    return STG_TOBOOL(result && count == sizeof(expected) / sizeof(expected[0]));
+}
+
+stg_bool_t test_unicode(void)
+{
+    const char *source = "na\xc3\xafve = gr\xc3\xb6\xc3\x9f" "e + \xe5\xa4\x89\xe6\x95\xb0_1 \xc2\xb7 x\n"
+        " \xce\xb1\xe2\x86\x92\xce\xb2";
+    struct { stg_lexer_token_type type; stg_size_t length, row, col; } expected[] = {
+        { STG_LEXER_TOKEN_IDENTIFIER, 6, 1, 1 },  // naïve
+        { STG_LEXER_TOKEN_SYMBOL, 1, 1, 7 },
+        { STG_LEXER_TOKEN_IDENTIFIER, 7, 1, 9 },  // größe
+        { STG_LEXER_TOKEN_SYMBOL, 1, 1, 15 },
+        { STG_LEXER_TOKEN_IDENTIFIER, 8, 1, 17 }, // 変数_1
+        { STG_LEXER_TOKEN_SYMBOL, 2, 1, 22 },     // · continues identifiers but does not start them
+        { STG_LEXER_TOKEN_IDENTIFIER, 1, 1, 24 },
+        { STG_LEXER_TOKEN_IDENTIFIER, 2, 2, 2 },  // α
+        { STG_LEXER_TOKEN_SYMBOL, 3, 2, 3 },      // →
+        { STG_LEXER_TOKEN_IDENTIFIER, 2, 2, 4 },  // β
+    };
+
+    stg_lexer lexer;
+    if(!stg_lexer_init(&lexer, source)) return STG_FALSE;
+    stg_lexer_token token;
+    stg_bool_t result = STG_TRUE;
+    for(stg_size_t i = 0; result && i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        result = stg_lexer_next(&lexer, &token);
+        result = STG_TOBOOL(result && token.type == expected[i].type && token.literal.count == expected[i].length &&
+                token.location.row == expected[i].row && token.location.col == expected[i].col);
+        if(!result) fprintf(stderr, "Unexpected unicode token %llu: "STG_SV_FMT"\n", i, STG_SV_ARGV(token.literal));
+    }
+    stg_lexer_free_lookahead(&lexer);
+    if(!result) return STG_FALSE;
+
+    // Malformed UTF-8 fails init unless the config allows it
+    const char *malformed = "a \xc3 b \xed\xa0\x80";
+    if(stg_lexer_init(&lexer, malformed)) return STG_FALSE;
+    stg_lexer_config config = *stg_lexer_default_config();
+    config.allow_invalid_utf8 = STG_TRUE;
+    if(!stg_lexer_init_with_config(&lexer, malformed, &config)) return STG_FALSE;
+    stg_size_t count = 0;
+    while(stg_lexer_next(&lexer, &token)) count += 1;
+    stg_lexer_free_lookahead(&lexer);
+    if(count != 6) return STG_FALSE;
+
+    // And so does an edit that cuts a code point in half
+    char buffer[64];
+    strcpy(buffer, "x = \xc3\xa9t\xc3\xa9");
+    stg_lexer_tokens tokens;
+    if(!stg_lexer_tokens_init(&tokens, buffer)) return STG_FALSE;
+    memmove(buffer + 5, buffer + 6, strlen(buffer + 6) + 1);
+    stg_lexer_edit edit = { 5, 1, 0 };
+    result = STG_TOBOOL(!stg_lexer_tokens_relex(&tokens, buffer, edit));
+    stg_lexer_tokens_deinit(&tokens);
+    return result;
+}
+
 int main(int argc, char **argv) {
+    if(!test_unicode()) {
+        fprintf(stderr, "Unicode test failed\n");
+        return -1;
+    }
+
+    if(!test_config()) {
+        fprintf(stderr, "Config test failed\n");
+        return -1;
+    }
+
+    if(!test_numbers()) {
+        fprintf(stderr, "Number test failed\n");
+        return -1;
+    }
+
+    if(!test_token_cache()) {
+        fprintf(stderr, "Token cache test failed\n");
+        return -1;
+    }
+
+    if(!test_relex()) {
+        fprintf(stderr, "Relex test failed\n");
+        return -1;
+    }
+
+    if(!test_lookahead()) {
+        fprintf(stderr, "Lookahead test failed\n");
+        return -1;
+    }
+
     if(argc < 2) { 
         fprintf(stderr, "Please provide the file path\n");
         return -1;
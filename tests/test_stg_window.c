@@ -0,0 +1,75 @@
+#define STG_IMPLEMENTATION
+#include "../stg_window.h"
+#include <stdio.h>
+
+static stg_device device;
+
+void dump_histogram_percentiles(const char *name, const stg_size_t *histogram)
+{
+    printf("%s: p50=%lluns p90=%lluns p99=%lluns\n", name,
+            stg_device_stats_percentile(histogram, 50),
+            stg_device_stats_percentile(histogram, 90),
+            stg_device_stats_percentile(histogram, 99));
+}
+
+int main(void)
+{
+    stg_event event = {0};
+    event.type = STG_EVENT_CURSOR_MOVED;
+    for(int i = 0; i < STG_EVENT_QUEUE_CAPACITY + 8; ++i) {
+        event.as.cursor_event.x = i;
+        stg_push_event(&device, event);
+    }
+
+    stg_event shifted;
+    int expected_x = 0;
+    while(stg_shift_event(&device, &shifted) != STG_FALSE) {
+        if(shifted.as.cursor_event.x != expected_x || shifted.timestamp == 0) {
+            fprintf(stderr, "Unexpected event %d (expected %d)\n", shifted.as.cursor_event.x, expected_x);
+            return -1;
+        }
+        expected_x += 1;
+    }
+
+    stg_device_stats stats;
+    stg_get_device_stats(&device, &stats);
+    printf("pushed=%llu shifted=%llu dropped=%llu high_water=%llu count=%llu\n",
+            stats.pushed_events, stats.shifted_events, stats.dropped_events,
+            stats.queue_high_water, stats.queue_count);
+    dump_histogram_percentiles("event age", stats.event_age_histogram);
+
+    if(stats.dropped_events != 8 || stats.queue_high_water != STG_EVENT_QUEUE_CAPACITY || stats.queue_count != 0) {
+        fprintf(stderr, "Unexpected event queue stats\n");
+        return -1;
+    }
+
+    // No display is open, so nothing is collected but the call is still timed
+    stg_collect_events(&device);
+    stg_collect_events(&device);
+    stg_get_device_stats(&device, &stats);
+    if(stats.collect_calls != 2 || stats.collect_total_ns < stats.collect_max_ns || stats.queue_count != 0
+            || stg_device_stats_percentile(stats.collect_histogram, 100) == 0) {
+        fprintf(stderr, "Unexpected collect stats\n");
+        return -1;
+    }
+
+    // ConfigureNotify is a resize the first time and when the size changes, a move when only
+    // the position does and nothing otherwise
+    XConfigureEvent xconfigure = {0};
+    xconfigure.window = 1;
+    xconfigure.width = 640;
+    xconfigure.height = 480;
+    stg_event configured = {0};
+    stg_event_type expected_types[] = { STG_EVENT_WINDOW_RESIZED, STG_EVENT_WINDOW_MOVED, STG_INVALID_EVENT, STG_EVENT_WINDOW_RESIZED };
+    for(int i = 0; i < 4; ++i) {
+        if(i == 1) xconfigure.x = 10;
+        if(i == 3) xconfigure.width = 800;
+        configured.type = STG_INVALID_EVENT;
+        stg__x11_translate_configure(&device.platform, &xconfigure, &configured);
+        if(configured.type != expected_types[i]) {
+            fprintf(stderr, "Unexpected event %d for ConfigureNotify %d\n", configured.type, i);
+            return -1;
+        }
+    }
+    return 0;
+}